@@ -237,6 +237,7 @@ struct AObject {
     struct {
       struct {
         uint8_t on_leak_check_ : 1;
+        uint8_t in_magazine_ : 1;
       };
     };
   };
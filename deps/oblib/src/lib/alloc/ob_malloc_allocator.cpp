@@ -371,13 +371,15 @@ void ObMallocAllocator::print_tenant_memory_usage(uint64_t tenant_id) const
       } else {
         int64_t ctx_pos = 0;
         const volatile int64_t *ctx_hold_bytes = mgr->get_ctx_hold_bytes();
+        const volatile int64_t *ctx_huge_page_hold_bytes = mgr->get_ctx_huge_page_hold_bytes();
         for (uint64_t i = 0; i < ObCtxIds::MAX_CTX_ID; i++) {
-          if (ctx_hold_bytes[i] > 0) {
+          if (ctx_hold_bytes[i] > 0 || ctx_huge_page_hold_bytes[i] > 0) {
             int64_t limit = 0;
             IGNORE_RETURN mgr->get_ctx_limit(i, limit);
             ret = databuff_printf(buf, BUFLEN, ctx_pos,
-                "[MEMORY] ctx_id=%25s hold_bytes=%'15ld limit=%'26ld\n",
-                get_global_ctx_info().get_ctx_name(i), ctx_hold_bytes[i], limit);
+                "[MEMORY] ctx_id=%25s hold_bytes=%'15ld huge_page_hold_bytes=%'15ld limit=%'26ld\n",
+                get_global_ctx_info().get_ctx_name(i), ctx_hold_bytes[i],
+                ctx_huge_page_hold_bytes[i], limit);
           }
         }
         if (OB_SUCC(ret)) {
@@ -27,6 +27,7 @@ using namespace oceanbase::common;
 void ObTenantCtxAllocator::set_tenant_deleted()
 {
   ATOMIC_STORE(&has_deleted_, true);
+  obj_mgr_.flush_magazines();
   set_idle(0);
 }
 
@@ -114,6 +115,8 @@ void ObTenantCtxAllocator::free(void *ptr)
     abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
                  || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
     abort_unless(obj->in_use_);
+    // objects cached in a magazine stay in use, catch a double free of them here
+    abort_unless(!obj->in_magazine_);
     SANITY_POISON(obj->data_, obj->alloc_bytes_);
     obj_mgr_.free_object(obj);
   }
@@ -431,6 +434,7 @@ int64_t ObTenantCtxAllocator::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
 
+  obj_mgr_.flush_magazines();
   auto stat = obj_mgr_.get_stat();
   const double min_utilization = 0.9;
   if (stat.payload_ * min_utilization > stat.used_) {
@@ -63,10 +63,13 @@ ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64
   : ta_(allocator), attr_(tenant_id, nullptr, ctx_id),
     sub_cnt_(1),
     root_mgr_(common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_),
+    enable_magazine_(common::ObCtxIds::LOGGER_CTX_ID != attr_.ctx_id_
+                     && common::ObCtxIds::LIBEASY != attr_.ctx_id_),
     last_wash_ts_(0), last_washed_size_(0)
 {
   root_mgr_.set_tenant_ctx_allocator(allocator, attr_);
   MEMSET(sub_mgrs_, 0, sizeof(sub_mgrs_));
+  MEMSET(magazines_, 0, sizeof(magazines_));
   sub_mgrs_[0] = &root_mgr_;
 }
 
@@ -76,6 +79,13 @@ ObjectMgr::~ObjectMgr()
 }
 
 void ObjectMgr::reset() {
+  flush_magazines();
+  for (int i = 0; i < MAGAZINE_CNT; i++) {
+    if (magazines_[i] != nullptr) {
+      destroy_magazine(magazines_[i]);
+      ATOMIC_STORE(&magazines_[i], nullptr);
+    }
+  }
   for (int i = 1; i < ATOMIC_LOAD(&sub_cnt_); i++) {
     if (sub_mgrs_[i] != nullptr) {
       destroy_sub_mgr(sub_mgrs_[i]);
@@ -90,6 +100,25 @@ AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
   AObject *obj = NULL;
   const uint64_t start = common::get_itid();
   SubObjectMgr *sub_mgr = nullptr;
+  ObjectMagazine *magazine = nullptr;
+  if (enable_magazine_ && size > 0
+      && OB_NOT_NULL(magazine = ATOMIC_LOAD(&magazines_[start % MAGAZINE_CNT]))) {
+    const uint64_t all_size = align_up2(MAX(size, MIN_AOBJECT_SIZE) + AOBJECT_META_SIZE, 16);
+    const uint32_t cls = (uint32_t)(1 + ((all_size - 1) / AOBJECT_CELL_BYTES));
+    if (cls <= ObjectMagazine::MAX_CACHED_CELLS && magazine->trylock()) {
+      obj = magazine->pop(cls, static_cast<uint32_t>(size));
+      magazine->unlock();
+      if (NULL != obj) {
+        obj->in_magazine_ = false;
+        if (attr.label_.str_ != nullptr) {
+          STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
+          obj->label_[sizeof(obj->label_) - 1] = '\0';
+        } else {
+          obj->label_[0] = '\0';
+        }
+      }
+    }
+  }
   for (uint64_t i = 0; NULL == obj && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
     sub_mgr = ATOMIC_LOAD(&sub_mgrs_[idx]);
@@ -159,10 +188,67 @@ void ObjectMgr::free_object(AObject *obj)
   abort_unless(block->obj_set_ != NULL);
 
   ObjectSet *set = block->obj_set_;
-  set->free_object(obj);
+  bool cached = false;
+  // magazines of a deleted tenant have been flushed, objects go back to their sets directly
+  if (enable_magazine_ && !ta_.has_deleted()
+      && !obj->is_large_ && obj->nobjs_ <= ObjectMagazine::MAX_CACHED_CELLS) {
+    abort_unless(!obj->in_magazine_);
+    abort_unless(AOBJECT_TAIL_MAGIC_CODE == reinterpret_cast<uint64_t&>(obj->data_[obj->alloc_bytes_]));
+    ObjectMagazine *magazine = get_magazine();
+    if (OB_NOT_NULL(magazine) && magazine->trylock()) {
+      AObject *flush_objs[ObjectMagazine::CAPACITY];
+      int64_t flush_cnt = 0;
+      // check again under the slot lock: set_tenant_deleted() stores the flag before it flushes
+      // every slot under this lock, so either the flush comes after this push and takes it, or
+      // the flag is seen here and nothing is parked in a flushed slot
+      if (!ta_.has_deleted()) {
+        // cached objects are still in use for memory dump, account them to a label of their own
+        STRNCPY(&obj->label_[0], "ObjMagazine", sizeof(obj->label_));
+        obj->label_[sizeof(obj->label_) - 1] = '\0';
+        obj->in_magazine_ = true;
+        flush_cnt = magazine->push(obj, flush_objs);
+        cached = true;
+      }
+      magazine->unlock();
+      free_objects(flush_objs, flush_cnt);
+    }
+  }
+  if (!cached) {
+    set->free_object(obj);
+  }
   // TODO by fengshuo.fs: when object_set is empty, try free the sub_mgr of it.
 }
 
+void ObjectMgr::flush_magazines()
+{
+  AObject *objs[ObjectMagazine::MAX_CACHED_CNT];
+  for (int i = 0; i < MAGAZINE_CNT; i++) {
+    ObjectMagazine *magazine = ATOMIC_LOAD(&magazines_[i]);
+    if (OB_NOT_NULL(magazine)) {
+      magazine->lock();
+      const int64_t cnt = magazine->pop_all(objs);
+      magazine->unlock();
+      free_objects(objs, cnt);
+    }
+  }
+}
+
+void ObjectMgr::free_objects(AObject **objs, const int64_t cnt)
+{
+  // objects of the same thread slot mostly come from one ObjectSet, free them run by run
+  int64_t start = 0;
+  for (int64_t i = 1; i <= cnt; i++) {
+    ObjectSet *set = objs[start]->block()->obj_set_;
+    if (i == cnt || objs[i]->block()->obj_set_ != set) {
+      for (int64_t j = start; j < i; j++) {
+        objs[j]->in_magazine_ = false;
+      }
+      set->free_objects(objs + start, i - start);
+      start = i;
+    }
+  }
+}
+
 ABlock *ObjectMgr::alloc_block(uint64_t size, const ObMemAttr &attr)
 {
   ABlock *block = NULL;
@@ -248,6 +334,46 @@ void ObjectMgr::destroy_sub_mgr(SubObjectMgr *sub_mgr)
   }
 }
 
+ObjectMagazine *ObjectMgr::get_magazine()
+{
+  const int64_t idx = common::get_itid() % MAGAZINE_CNT;
+  ObjectMagazine *magazine = ATOMIC_LOAD(&magazines_[idx]);
+  if (OB_ISNULL(magazine)) {
+    auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+    auto &root_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_;
+    ObMemAttr attr;
+    attr.tenant_id_ = OB_SERVER_TENANT_ID;
+    attr.label_ = common::ObModIds::OB_TENANT_CTX_ALLOCATOR;
+    attr.ctx_id_ = ObCtxIds::DEFAULT_CTX_ID;
+    root_mgr.lock();
+    auto *obj = root_mgr.alloc_object(sizeof(ObjectMagazine), attr);
+    root_mgr.unlock();
+    if (OB_NOT_NULL(obj)) {
+      SANITY_UNPOISON(obj->data_, obj->alloc_bytes_);
+      magazine = new (obj->data_) ObjectMagazine();
+      if (!ATOMIC_BCAS(&magazines_[idx], nullptr, magazine)) {
+        destroy_magazine(magazine);
+        magazine = ATOMIC_LOAD(&magazines_[idx]);
+      }
+    }
+  }
+  return magazine;
+}
+
+void ObjectMgr::destroy_magazine(ObjectMagazine *magazine)
+{
+  if (magazine != nullptr) {
+    auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+    auto &root_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_;
+    magazine->~ObjectMagazine();
+    auto *obj = reinterpret_cast<AObject*>((char*)magazine - AOBJECT_HEADER_SIZE);
+    abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
+                 || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
+    SANITY_POISON(obj->data_, obj->alloc_bytes_);
+    root_mgr.free_object(obj);
+  }
+}
+
 int64_t ObjectMgr::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
@@ -76,9 +76,72 @@ private:
   ObjectSet os_;
 };
 
+// Freed small objects cached per thread slot, so that a thread allocating the
+// same size again does not take the ObjectSet lock. Cached objects stay in use
+// in their ObjectSet, block hold and tenant accounting do not change until they
+// are flushed back in batches.
+class ObjectMagazine
+{
+public:
+  static const uint32_t MAX_CACHED_CELLS = 32;
+  static const int64_t CAPACITY = 16;
+  static const int64_t MAX_CACHED_CNT = (MAX_CACHED_CELLS + 1) * CAPACITY;
+  ObjectMagazine() : lock_(0)
+  {
+    MEMSET(cnts_, 0, sizeof(cnts_));
+  }
+  OB_INLINE bool trylock() { return ATOMIC_BCAS(&lock_, 0, 1); }
+  OB_INLINE void lock()
+  {
+    while (!trylock()) {
+      PAUSE();
+    }
+  }
+  OB_INLINE void unlock() { ATOMIC_STORE(&lock_, 0); }
+  OB_INLINE AObject *pop(const uint32_t cls, const uint32_t size)
+  {
+    AObject *obj = NULL;
+    int64_t &cnt = cnts_[cls];
+    if (cnt > 0 && size == objs_[cls][cnt - 1]->alloc_bytes_) {
+      obj = objs_[cls][--cnt];
+    }
+    return obj;
+  }
+  // when the slot of obj is full, the older half is moved to flush_objs and its count returned
+  OB_INLINE int64_t push(AObject *obj, AObject **flush_objs)
+  {
+    int64_t flush_cnt = 0;
+    const uint32_t cls = obj->nobjs_;
+    int64_t &cnt = cnts_[cls];
+    if (cnt >= CAPACITY) {
+      flush_cnt = CAPACITY / 2;
+      MEMCPY(flush_objs, objs_[cls], flush_cnt * sizeof(AObject*));
+      MEMMOVE(objs_[cls], objs_[cls] + flush_cnt, (cnt - flush_cnt) * sizeof(AObject*));
+      cnt -= flush_cnt;
+    }
+    objs_[cls][cnt++] = obj;
+    return flush_cnt;
+  }
+  int64_t pop_all(AObject **objs)
+  {
+    int64_t pop_cnt = 0;
+    for (uint32_t cls = 0; cls <= MAX_CACHED_CELLS; ++cls) {
+      MEMCPY(objs + pop_cnt, objs_[cls], cnts_[cls] * sizeof(AObject*));
+      pop_cnt += cnts_[cls];
+      cnts_[cls] = 0;
+    }
+    return pop_cnt;
+  }
+private:
+  int64_t lock_;
+  int64_t cnts_[MAX_CACHED_CELLS + 1];
+  AObject *objs_[MAX_CACHED_CELLS + 1][CAPACITY];
+};
+
 class ObjectMgr : public IBlockMgr
 {
   static const int N = 32;
+  static const int MAGAZINE_CNT = 16;
 public:
   struct Stat
   {
@@ -108,9 +171,14 @@ public:
   void print_usage() const;
   int64_t sync_wash(int64_t wash_size) override;
   Stat get_stat();
+  // give the objects cached in magazines back to their ObjectSets
+  void flush_magazines();
 private:
   SubObjectMgr *create_sub_mgr();
   void destroy_sub_mgr(SubObjectMgr *sub_mgr);
+  ObjectMagazine *get_magazine();
+  void destroy_magazine(ObjectMagazine *magazine);
+  void free_objects(AObject **objs, const int64_t cnt);
 
 public:
   ObTenantCtxAllocator &ta_;
@@ -118,6 +186,8 @@ public:
   int sub_cnt_;
   SubObjectMgr root_mgr_;
   SubObjectMgr *sub_mgrs_[N];
+  const bool enable_magazine_;
+  ObjectMagazine *magazines_[MAGAZINE_CNT];
   int64_t last_wash_ts_;
   int64_t last_washed_size_;
 }; // end of class ObjectMgr
@@ -86,6 +86,7 @@ AObject *ObjectSet::alloc_object(
 
     reinterpret_cast<uint64_t&>(obj->data_[size]) = AOBJECT_TAIL_MAGIC_CODE;
     obj->alloc_bytes_ = static_cast<uint32_t>(size);
+    obj->in_magazine_ = false;
 
     if (attr.label_.str_ != nullptr) {
       STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
@@ -408,6 +409,20 @@ void ObjectSet::free_object(AObject *obj)
   }
 }
 
+void ObjectSet::free_objects(AObject **objs, const int64_t cnt)
+{
+  locker_->lock();
+  for (int64_t i = 0; i < cnt; ++i) {
+    AObject *obj = objs[i];
+    abort_unless(obj != NULL);
+    abort_unless(obj->is_valid());
+    abort_unless(obj->in_use_);
+    abort_unless(this == obj->block()->obj_set_);
+    do_free_object(obj);
+  }
+  locker_->unlock();
+}
+
 void ObjectSet::do_free_object(AObject *obj)
 {
   const int64_t hold = obj->hold(cells_per_block_);
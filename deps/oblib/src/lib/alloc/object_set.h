@@ -51,6 +51,8 @@ public:
   // main interfaces
   AObject *alloc_object(const uint64_t size, const ObMemAttr &attr);
   void free_object(AObject *obj);
+  // free objects of this set in one lock round
+  void free_objects(AObject **objs, const int64_t cnt);
   AObject *realloc_object(AObject *obj, const uint64_t size, const ObMemAttr &attr);
   void reset();
 
@@ -0,0 +1,303 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
+#define OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
+
+#include "lib/atomic/ob_atomic.h"
+#include "lib/hash/ob_pointer_hashmap.h"
+
+namespace oceanbase
+{
+namespace common
+{
+namespace hash
+{
+/**
+ * copy-on-write hash map only for pointer, for maps which are copied often
+ * but changed little between two copies.
+ *
+ * Keys are spread over CHUNK_COUNT chunks, each of them is a refcounted
+ * ObPointerHashArray. assign() shares all chunks of the other map, and a
+ * shared chunk is cloned before it is changed, so a copy costs O(CHUNK_COUNT)
+ * and a change copies one chunk at most.
+ *
+ * not thread safe, except that maps sharing chunks can be changed
+ * or destroyed concurrently. The allocator must be able to free memory
+ * allocated by another instance, as ModulePageAllocator does.
+ */
+template <class K, class V, template <class, class> class GetKey,
+          class Allocator = ModulePageAllocator>
+class ObCowPointerHashMap
+{
+  typedef ObPointerHashArray<K, V, GetKey> SubMap;
+  struct Chunk
+  {
+    int64_t ref_cnt_;
+    int64_t mem_size_;
+    SubMap *sub_map() { return reinterpret_cast<SubMap *>(this + 1); }
+    const SubMap *sub_map() const { return reinterpret_cast<const SubMap *>(this + 1); }
+  };
+public:
+  explicit ObCowPointerHashMap(const lib::ObLabel &label = ObModIds::OB_HASH_NODE)
+      : allocator_(label)
+  {
+    memset(chunks_, 0, sizeof(chunks_));
+  }
+
+  ~ObCowPointerHashMap()
+  {
+    destroy();
+  }
+
+  // chunks are created on demand
+  int init() { return OB_SUCCESS; }
+
+  void destroy()
+  {
+    for (int64_t i = 0; i < CHUNK_COUNT; ++i) {
+      release_chunk(chunks_[i]);
+      chunks_[i] = NULL;
+    }
+  }
+
+  void clear() { destroy(); }
+
+  // share all chunks of other
+  int assign(const ObCowPointerHashMap &other)
+  {
+    if (this != &other) {
+      destroy();
+      allocator_ = other.allocator_;
+      for (int64_t i = 0; i < CHUNK_COUNT; ++i) {
+        if (NULL != other.chunks_[i]) {
+          ATOMIC_INC(&other.chunks_[i]->ref_cnt_);
+          chunks_[i] = other.chunks_[i];
+        }
+      }
+    }
+    return OB_SUCCESS;
+  }
+
+  /**
+   * put a key value pair into HashMap
+   * when overwrite = 0, do not overwrite existing <key,value> pair
+   * when overwrite != 0 overwrite existing value
+   * @retval OB_SUCCESS  success
+   * @retval OB_HASH_EXIST key exist when overwrite = 0
+   * @retval other errors
+   */
+  int set_refactored(const K &key, const V &value, V &over_write_value, int overwrite = 0)
+  {
+    int ret = OB_SUCCESS;
+    const int64_t idx = key_to_chunk_idx(key);
+    over_write_value = (V(0));
+    if (OB_FAIL(prepare_write(idx))) {
+      COMMON_LOG(WARN, "prepare chunk for write failed", K(ret), K(idx));
+    } else {
+      ret = chunks_[idx]->sub_map()->set_refactored(key, value, over_write_value, overwrite);
+      if (OB_HASH_FULL == ret) {
+        if (OB_FAIL(extend_chunk(idx))) {
+          COMMON_LOG(WARN, "extend chunk failed", K(ret), K(idx));
+        } else {
+          ret = chunks_[idx]->sub_map()->set_refactored(key, value, over_write_value, overwrite);
+        }
+      }
+    }
+    return ret;
+  }
+
+  int set_refactored(const K &key, const V &value, int overwrite = 0)
+  {
+    V over_write_value = (V(0));
+    return set_refactored(key, value, over_write_value, overwrite);
+  }
+
+  /**
+   * @retval OB_SUCCESS get the corresponding value of key
+   * @retval OB_HASH_NOT_EXIST key does not exist
+   */
+  int get_refactored(const K &key, V &value) const
+  {
+    int hash_ret = OB_HASH_NOT_EXIST;
+    const Chunk *chunk = chunks_[key_to_chunk_idx(key)];
+    if (NULL != chunk) {
+      hash_ret = chunk->sub_map()->get_refactored(key, value);
+    }
+    return hash_ret;
+  }
+
+  const V *get(const K &key) const
+  {
+    const V *ret = NULL;
+    const Chunk *chunk = chunks_[key_to_chunk_idx(key)];
+    if (NULL != chunk) {
+      ret = chunk->sub_map()->get(key);
+    }
+    return ret;
+  }
+
+  // @retval OB_SUCCESS success
+  // @retval OB_HASH_NOT_EXIST key not found
+  // @retval other errors
+  int erase_refactored(const K &key, V &erased_value)
+  {
+    int ret = OB_SUCCESS;
+    const int64_t idx = key_to_chunk_idx(key);
+    erased_value = (V(0));
+    if (NULL == get(key)) {
+      // avoid cloning a shared chunk for nothing
+      ret = OB_HASH_NOT_EXIST;
+    } else if (OB_FAIL(prepare_write(idx))) {
+      COMMON_LOG(WARN, "prepare chunk for write failed", K(ret), K(idx));
+    } else {
+      ret = chunks_[idx]->sub_map()->erase_refactored(key, erased_value);
+    }
+    return ret;
+  }
+
+  int erase_refactored(const K &key)
+  {
+    V erased_value = (V(0));
+    return erase_refactored(key, erased_value);
+  }
+
+  int64_t count() const
+  {
+    int64_t total_count = 0;
+    for (int64_t i = 0; i < CHUNK_COUNT; ++i) {
+      if (NULL != chunks_[i]) {
+        total_count += chunks_[i]->sub_map()->count();
+      }
+    }
+    return total_count;
+  }
+
+  int64_t item_count() const
+  {
+    int64_t total_item_count = 0;
+    for (int64_t i = 0; i < CHUNK_COUNT; ++i) {
+      if (NULL != chunks_[i]) {
+        total_item_count += chunks_[i]->sub_map()->item_count();
+      }
+    }
+    return total_item_count;
+  }
+
+  // count of chunks shared with other maps, for monitor only
+  int64_t shared_chunk_count() const
+  {
+    int64_t shared_count = 0;
+    for (int64_t i = 0; i < CHUNK_COUNT; ++i) {
+      if (NULL != chunks_[i] && ATOMIC_LOAD(&chunks_[i]->ref_cnt_) > 1) {
+        ++shared_count;
+      }
+    }
+    return shared_count;
+  }
+
+private:
+  int64_t key_to_chunk_idx(const K &key) const
+  {
+    // the sub map probes with the low bits of the hash value, so use the high bits here
+    return static_cast<int64_t>((do_hash(key) * 0x9E3779B97F4A7C15ULL) >> (64 - CHUNK_BITS));
+  }
+
+  Chunk *create_chunk(const int64_t mem_size, const SubMap *sub_map_in = NULL)
+  {
+    Chunk *chunk = NULL;
+    void *chunk_mem = NULL;
+    if (NULL == (chunk_mem = allocator_.alloc(sizeof(Chunk) + mem_size))) {
+      COMMON_LOG(ERROR, "failed to allocate memory for chunk", K(mem_size));
+    } else {
+      chunk = static_cast<Chunk *>(chunk_mem);
+      chunk->ref_cnt_ = 1;
+      chunk->mem_size_ = mem_size;
+      if (NULL != sub_map_in) {
+        new (chunk->sub_map()) SubMap(*sub_map_in);
+      } else {
+        new (chunk->sub_map()) SubMap(mem_size);
+      }
+    }
+    return chunk;
+  }
+
+  void release_chunk(Chunk *chunk)
+  {
+    if (NULL != chunk && 0 == ATOMIC_AAF(&chunk->ref_cnt_, -1)) {
+      allocator_.free(chunk);
+    }
+  }
+
+  // make sure chunks_[idx] exists and is owned by this map only
+  int prepare_write(const int64_t idx)
+  {
+    int ret = OB_SUCCESS;
+    Chunk *chunk = chunks_[idx];
+    if (NULL == chunk) {
+      const int64_t mem_size =
+          SubMap::get_hash_array_mem_size(SubMap::MIN_HASH_ARRAY_ITEM_COUNT);
+      if (NULL == (chunks_[idx] = create_chunk(mem_size))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      }
+    } else if (ATOMIC_LOAD(&chunk->ref_cnt_) > 1) {
+      Chunk *new_chunk = create_chunk(chunk->mem_size_, chunk->sub_map());
+      if (NULL == new_chunk) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      } else {
+        chunks_[idx] = new_chunk;
+        release_chunk(chunk);
+      }
+    }
+    return ret;
+  }
+
+  // rebuild chunks_[idx] with a larger sub map, erased cells are dropped
+  int extend_chunk(const int64_t idx)
+  {
+    int ret = OB_SUCCESS;
+    Chunk *chunk = chunks_[idx];
+    SubMap *sub_map = chunk->sub_map();
+    const int64_t mem_size = SubMap::get_hash_array_mem_size(2 * (sub_map->item_count() + 1));
+    Chunk *new_chunk = create_chunk(mem_size);
+    if (NULL == new_chunk) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      for (typename SubMap::Iterator it = sub_map->begin();
+           OB_SUCC(ret) && it != sub_map->end(); ++it) {
+        if (OB_FAIL(new_chunk->sub_map()->set_refactored(sub_map->get_key(it), *it))) {
+          COMMON_LOG(WARN, "rehash chunk failed", K(ret), K(idx));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        chunks_[idx] = new_chunk;
+        release_chunk(chunk);
+      } else {
+        release_chunk(new_chunk);
+      }
+    }
+    return ret;
+  }
+
+private:
+  static const int64_t CHUNK_BITS = 5;
+  static const int64_t CHUNK_COUNT = 1L << CHUNK_BITS;
+  DISALLOW_COPY_AND_ASSIGN(ObCowPointerHashMap);
+private:
+  Chunk *chunks_[CHUNK_COUNT];
+  Allocator allocator_;
+};
+} // namespace hash
+} // namespace common
+} // namespace oceanbase
+
+#endif // OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
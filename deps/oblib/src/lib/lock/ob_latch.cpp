@@ -217,6 +217,7 @@ int ObLatchWaitQueue::wait(
     bool conflict = false;
     struct timespec ts;
     ObDiagnoseSessionInfo *dsi = ObDiagnoseSessionInfo::get_local_diagnose_info();
+    const bool is_queued = ObLatchPolicy::LATCH_QUEUED == OB_LATCHES[latch_id].policy_;
 
     //check if need wait
     if (OB_FAIL(try_lock(bucket, proc, latch_id, uid, lock_func))) {
@@ -246,6 +247,14 @@ int ObLatchWaitQueue::wait(
               true /*is_atomic*/);
           ts.tv_sec = timeout / 1000000;
           ts.tv_nsec = 1000 * (timeout % 1000000);
+          if (is_queued && ATOMIC_BCAS(&proc.wait_, 1, 2)) {
+            // spin on the own wait word, the handoff of a short critical section
+            // usually comes before a futex round trip would
+            for (int64_t i = 0; i < QUEUED_LOCAL_SPIN_CNT && 2 == ATOMIC_LOAD(&proc.wait_); ++i) {
+              PAUSE();
+            }
+            (void)ATOMIC_BCAS(&proc.wait_, 2, 1);
+          }
           // futex_wait is an atomic wait event
           if (ETIMEDOUT == (tmp_ret = futex_wait(&proc.wait_, 1, &ts))) {
             tmp_ret = OB_TIMEOUT;
@@ -392,9 +401,11 @@ int ObLatchWaitQueue::wake_up(ObLatch &latch, const bool only_rd_wait)
         pwait = &iter->wait_;
         //the proc.wait_ must be set to 0 at last, once the 0 is set, the *iter may be not valid any more
         MEM_BARRIER();
-        *pwait = 0;
-        // a thread waits using sys futex
-        if (1 == futex_wake(pwait, 1)) {
+        if (2 == ATOMIC_SET(pwait, 0)) {
+          // a queued waiter spinning on its wait word takes the handoff without futex
+          ++actual_wake_cnt;
+        } else if (1 == futex_wake(pwait, 1)) {
+          // a thread waits using sys futex
           ++actual_wake_cnt;
         }
       }
@@ -572,7 +583,7 @@ int ObLatch::try_rdlock(const uint32_t latch_id)
           COMMON_LOG(ERROR, "Too many read locks, ", K(lock), K(ret));
           break;
         } else {
-          if (ObLatchPolicy::LATCH_FIFO == OB_LATCHES[latch_id].policy_) {
+          if (ObLatchPolicy::LATCH_READ_PREFER != OB_LATCHES[latch_id].policy_) {
         	if (0 != (lock & WAIT_MASK)) {
         	  ret = OB_EAGAIN;
         	  break;
@@ -630,7 +641,7 @@ int ObLatch::rdlock(
       abs_timeout_us,
       uid,
       ObLatchWaitMode::READ_WAIT,
-      ObLatchPolicy::LATCH_FIFO == OB_LATCHES[latch_id].policy_ ? low_try_rdlock : low_try_rdlock_ignore,
+      ObLatchPolicy::LATCH_READ_PREFER != OB_LATCHES[latch_id].policy_ ? low_try_rdlock : low_try_rdlock_ignore,
       low_try_rdlock_ignore))) {
     if (OB_TIMEOUT != ret) {
       COMMON_LOG(WARN, "Fail to low lock, ", K(ret));
@@ -730,6 +741,8 @@ OB_INLINE int ObLatch::low_lock(
   uint64_t yield_cnt = 0;
   bool waited = false;
   bool conflict = false;
+  bool need_queue = false;
+  int64_t backoff = 1;
 
   if (OB_UNLIKELY(latch_id >= ObLatchIds::LATCH_END)
       || OB_UNLIKELY(abs_timeout_us <= 0)
@@ -740,6 +753,7 @@ OB_INLINE int ObLatch::low_lock(
     ret = OB_INVALID_ARGUMENT;
     COMMON_LOG(WARN, "Invalid argument", K(latch_id), K(uid), K(ret));
   } else {
+    const bool is_queued = ObLatchPolicy::LATCH_QUEUED == OB_LATCHES[latch_id].policy_;
     while (OB_SUCC(ret)) {
       //spin
       for (i = 0; OB_SUCC(ret) && i < OB_LATCHES[latch_id].max_spin_cnt_; ++i) {
@@ -749,6 +763,17 @@ OB_INLINE int ObLatch::low_lock(
         } else if (OB_EAGAIN == ret) {
           //retry
           ret = OB_SUCCESS;
+          if (is_queued) {
+            if (0 != (lock & WAIT_MASK)) {
+              //others are queued, the latch will be handed to them first
+              need_queue = true;
+              break;
+            }
+            for (int64_t j = 0; j < backoff; ++j) {
+              PAUSE();
+            }
+            backoff = MIN(backoff << 1, MAX_QUEUED_SPIN_BACKOFF);
+          }
         }
         PAUSE();
       }
@@ -756,11 +781,11 @@ OB_INLINE int ObLatch::low_lock(
 
       if (OB_FAIL(ret)) {
         //fail
-      } else if (i < OB_LATCHES[latch_id].max_spin_cnt_) {
+      } else if (!need_queue && i < OB_LATCHES[latch_id].max_spin_cnt_) {
         //success lock
         ++spin_cnt;
         break;
-      } else if (yield_cnt < OB_LATCHES[latch_id].max_yield_cnt_) {
+      } else if (!need_queue && yield_cnt < OB_LATCHES[latch_id].max_yield_cnt_) {
         //yield and retry
         sched_yield();
         ++yield_cnt;
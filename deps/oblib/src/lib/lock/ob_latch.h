@@ -72,6 +72,8 @@ extern bool USE_CO_LATCH;
           ObDiagnoseSessionInfo *dsi = ObDiagnoseSessionInfo::get_local_diagnose_info();              \
           if (NULL != dsi) {                                                                          \
             latch_stat.wait_time_ += dsi->get_curr_wait().wait_time_;                                 \
+            ++latch_stat.wait_time_hist_[ObLatchStat::get_wait_time_hist_idx(                       \
+                dsi->get_curr_wait().wait_time_)];                                                    \
             if (dsi->get_curr_wait().wait_time_ > 1000 * 1000) {                                      \
               COMMON_LOG(WARN, "The Latch wait too much time, ",                                      \
                   K(dsi->get_curr_wait()), KCSTRING(lbt()));                                          \
@@ -200,6 +202,7 @@ private:
 
 private:
   static const uint64_t LATCH_MAP_BUCKET_CNT = 3079;
+  static const int64_t QUEUED_LOCAL_SPIN_CNT = 1000;
   ObLatchBucket wait_map_[LATCH_MAP_BUCKET_CNT];
 
 private:
@@ -259,6 +262,7 @@ private:
   static const uint32_t WRITE_MASK = 1<<30;
   static const uint32_t WAIT_MASK = 1<<31;
   static const uint32_t MAX_READ_LOCK_CNT = 1<<24;
+  static const int64_t MAX_QUEUED_SPIN_BACKOFF = 64;
   volatile uint32_t lock_;
 };
 
@@ -28,6 +28,7 @@
 using namespace oceanbase::lib;
 
 int ObLargePageHelper::large_page_type_ = INVALID_LARGE_PAGE_TYPE;
+uint64_t ObLargePageHelper::large_page_ctx_mask_ = UINT64_MAX;
 
 void ObLargePageHelper::set_param(const char *param)
 {
@@ -52,6 +53,39 @@ int ObLargePageHelper::get_type()
 #endif
 }
 
+void ObLargePageHelper::set_ctx_param(const char *param)
+{
+  STATIC_ASSERT(common::ObCtxIds::MAX_CTX_ID <= 64, "ctx mask overflow");
+  uint64_t mask = 0;
+  if (OB_ISNULL(param) || '\0' == param[0] || 0 == strcasecmp(param, "all")) {
+    mask = UINT64_MAX;
+  } else {
+    char buf[1024];
+    char *save_ptr = nullptr;
+    snprintf(buf, sizeof(buf), "%s", param);
+    for (char *name = strtok_r(buf, ", ", &save_ptr);
+         nullptr != name;
+         name = strtok_r(nullptr, ", ", &save_ptr)) {
+      uint64_t ctx_id = 0;
+      if (common::get_global_ctx_info().is_valid_ctx_name(name, ctx_id)) {
+        mask |= (1UL << ctx_id);
+      } else {
+        LOG_WARN("invalid ctx name for large page", K(name));
+      }
+    }
+  }
+  if (mask != ATOMIC_LOAD(&large_page_ctx_mask_)) {
+    ATOMIC_STORE(&large_page_ctx_mask_, mask);
+    LOG_INFO("set large page ctx param", K(param), K(mask));
+  }
+}
+
+bool ObLargePageHelper::can_use_large_page(const uint64_t ctx_id)
+{
+  return ctx_id < common::ObCtxIds::MAX_CTX_ID
+      && 0 != (ATOMIC_LOAD(&large_page_ctx_mask_) & (1UL << ctx_id));
+}
+
 AChunkMgr &AChunkMgr::instance()
 {
   static AChunkMgr mgr;
@@ -59,11 +93,39 @@ AChunkMgr &AChunkMgr::instance()
 }
 
 AChunkMgr::AChunkMgr()
-  : free_list_(), chunk_bitmap_(nullptr), limit_(DEFAULT_LIMIT), urgent_(0), hold_(0),
-    total_hold_(0), maps_(0), unmaps_(0), large_maps_(0), large_unmaps_(0), shadow_hold_(0)
+  : free_list_(), huge_free_list_(), max_chunk_cache_cnt_(AChunkList::DEFAULT_MAX_CHUNK_CACHE_CNT),
+    chunk_bitmap_(nullptr), limit_(DEFAULT_LIMIT), urgent_(0), hold_(0), total_hold_(0),
+    maps_(0), unmaps_(0), large_maps_(0), large_unmaps_(0),
+    huge_page_maps_(0), huge_page_unmaps_(0), huge_page_hold_(0), shadow_hold_(0)
 {
 }
 
+AChunk *AChunkMgr::pop_free_chunk(const bool can_use_huge_page)
+{
+  AChunk *chunk = nullptr;
+  // huge page chunks are kept for ctx which asked for them, but a normal
+  // chunk is always good enough to avoid a fresh mmap.
+  if (can_use_huge_page && huge_free_list_.count() > 0) {
+    chunk = huge_free_list_.pop();
+  }
+  if (OB_ISNULL(chunk) && free_list_.count() > 0) {
+    chunk = free_list_.pop();
+  }
+  return chunk;
+}
+
+AChunk *AChunkMgr::pop_any_free_chunk()
+{
+  AChunk *chunk = nullptr;
+  if (free_list_.count() > 0) {
+    chunk = free_list_.pop();
+  }
+  if (OB_ISNULL(chunk) && huge_free_list_.count() > 0) {
+    chunk = huge_free_list_.pop();
+  }
+  return chunk;
+}
+
 void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow)
 {
   common::ObTimeGuard time_guard(__func__, 1000 * 1000);
@@ -100,6 +162,10 @@ void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page,
     if (size > INTACT_ACHUNK_SIZE) {
       ATOMIC_FAA(&large_maps_, 1);
     }
+    if (huge_page_used) {
+      ATOMIC_FAA(&huge_page_maps_, 1);
+      ATOMIC_FAA(&huge_page_hold_, size);
+    }
   } else {
     LOG_ERROR("low alloc fail", K(size), K(orig_errno), K(errno));
     auto &afc = g_alloc_failed_ctx();
@@ -111,7 +177,7 @@ void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page,
   return ptr;
 }
 
-void AChunkMgr::direct_free(const void *ptr, const uint64_t size)
+void AChunkMgr::direct_free(const void *ptr, const uint64_t size, const bool huge_page_used)
 {
   common::ObTimeGuard time_guard(__func__, 1000 * 1000);
   EVENT_INC(MUNMAP_COUNT);
@@ -120,6 +186,10 @@ void AChunkMgr::direct_free(const void *ptr, const uint64_t size)
   if (size > INTACT_ACHUNK_SIZE) {
     ATOMIC_FAA(&large_unmaps_, 1);
   }
+  if (huge_page_used) {
+    ATOMIC_FAA(&huge_page_unmaps_, 1);
+    ATOMIC_FAA(&huge_page_hold_, -size);
+  }
   low_free(ptr, size);
 }
 
@@ -196,7 +266,7 @@ void AChunkMgr::low_free(const void *ptr, const uint64_t size)
   ::munmap((void*)ptr, size);
 }
 
-AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
+AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio, bool can_use_huge_page)
 {
   const int64_t hold_size = hold(size);
   const int64_t all_size = aligned(size);
@@ -207,13 +277,11 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
   if (achunk_size == hold_size) {
     // TODO by fengshuo.fs: chunk cached by freelist may not use all memory in it,
     //                      so update_hold can use hold_size too.
-    if (free_list_.count() > 0) {
-      chunk = free_list_.pop();
-    }
+    chunk = pop_free_chunk(can_use_huge_page);
     if (OB_ISNULL(chunk)) {
       if (update_hold(hold_size, high_prio)) {
         bool hugetlb_used = false;
-        void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
+        void *ptr = direct_alloc(all_size, can_use_huge_page, hugetlb_used, SANITY_BOOL_EXPR(true));
         if (ptr != nullptr) {
           chunk = new (ptr) AChunk();
           chunk->is_hugetlb_ = hugetlb_used;
@@ -226,9 +294,9 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     }
   } else {
     bool updated = false;
-    while (!(updated = update_hold(hold_size, high_prio)) && free_list_.count() > 0) {
-      if (OB_NOT_NULL(chunk = free_list_.pop())) {
-        direct_free(chunk, achunk_size);
+    while (!(updated = update_hold(hold_size, high_prio)) && get_free_chunk_count() > 0) {
+      if (OB_NOT_NULL(chunk = pop_any_free_chunk())) {
+        direct_free(chunk, achunk_size, chunk->is_hugetlb_);
         IGNORE_RETURN update_hold(-achunk_size, high_prio);
         IGNORE_RETURN ATOMIC_FAA(&total_hold_, -achunk_size);
         chunk = nullptr;
@@ -236,7 +304,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     }
     if (updated) {
       bool hugetlb_used = false;
-      void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
+      void *ptr = direct_alloc(all_size, can_use_huge_page, hugetlb_used, SANITY_BOOL_EXPR(true));
       if (ptr != nullptr) {
         chunk = new (ptr) AChunk();
         chunk->is_hugetlb_ = hugetlb_used;
@@ -267,16 +335,20 @@ void AChunkMgr::free_chunk(AChunk *chunk)
     const uint64_t all_size = chunk->aligned();
     const int64_t achunk_size = INTACT_ACHUNK_SIZE;
     bool freed = true;
+    const bool is_hugetlb = chunk->is_hugetlb_;
     if (achunk_size == hold_size) {
-      if (hold_ + hold_size <= limit_) {
-        freed = !free_list_.push(chunk);
+      // each list is bounded by max_chunk_cache_cnt_ too, this keeps their sum
+      // around the budget, a racing push may exceed it by a few chunks.
+      if (hold_ + hold_size <= limit_
+          && get_free_chunk_count() < ATOMIC_LOAD(&max_chunk_cache_cnt_)) {
+        freed = is_hugetlb ? !huge_free_list_.push(chunk) : !free_list_.push(chunk);
       }
       if (freed) {
-        direct_free(chunk, all_size);
+        direct_free(chunk, all_size, is_hugetlb);
         IGNORE_RETURN update_hold(-hold_size, false);
       }
     } else {
-      direct_free(chunk, all_size);
+      direct_free(chunk, all_size, is_hugetlb);
       IGNORE_RETURN update_hold(-hold_size, false);
     }
     if (freed) {
@@ -294,9 +366,9 @@ AChunk *AChunkMgr::alloc_co_chunk(const uint64_t size)
 
   AChunk *chunk = nullptr;
   bool updated = false;
-  while (!(updated = update_hold(hold_size, true)) && free_list_.count() > 0) {
-    if (OB_NOT_NULL(chunk = free_list_.pop())) {
-      direct_free(chunk, achunk_size);
+  while (!(updated = update_hold(hold_size, true)) && get_free_chunk_count() > 0) {
+    if (OB_NOT_NULL(chunk = pop_any_free_chunk())) {
+      direct_free(chunk, achunk_size, chunk->is_hugetlb_);
       IGNORE_RETURN update_hold(-achunk_size, true);
       IGNORE_RETURN ATOMIC_FAA(&total_hold_, -achunk_size);
       chunk = nullptr;
@@ -334,7 +406,7 @@ void AChunkMgr::free_co_chunk(AChunk *chunk)
     const int64_t hold_size = chunk->hold();
     const uint64_t all_size = chunk->aligned();
     const int64_t achunk_size = INTACT_ACHUNK_SIZE;
-    direct_free(chunk, all_size);
+    direct_free(chunk, all_size, chunk->is_hugetlb_);
     IGNORE_RETURN update_hold(-hold_size, false);
     IGNORE_RETURN ATOMIC_FAA(&total_hold_, -all_size);
   }
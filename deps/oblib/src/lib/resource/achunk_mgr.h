@@ -159,8 +159,12 @@ public:
 public:
   static void set_param(const char *param);
   static int get_type();
+  // comma separated ctx names which may be backed by large pages, empty means all ctx.
+  static void set_ctx_param(const char *param);
+  static bool can_use_large_page(const uint64_t ctx_id);
 private:
   static int large_page_type_;
+  static uint64_t large_page_ctx_mask_;
 };
 
 class AChunkMgr
@@ -177,14 +181,20 @@ public:
 
   AChunk *alloc_chunk(
       const uint64_t size = ACHUNK_SIZE,
-      bool high_prio = false);
+      bool high_prio = false,
+      bool can_use_huge_page = true);
   void free_chunk(AChunk *chunk);
   AChunk *alloc_co_chunk(const uint64_t size = ACHUNK_SIZE);
   void free_co_chunk(AChunk *chunk);
   static OB_INLINE uint64_t aligned(const uint64_t size);
   static OB_INLINE uint64_t hold(const uint64_t size);
+  // cnt limits the chunks cached by free_list_ and huge_free_list_ together
   void set_max_chunk_cache_cnt(const int cnt)
-  { free_list_.set_max_chunk_cache_cnt(cnt); }
+  {
+    free_list_.set_max_chunk_cache_cnt(cnt);
+    huge_free_list_.set_max_chunk_cache_cnt(cnt);
+    ATOMIC_STORE(&max_chunk_cache_cnt_, cnt);
+  }
 
   inline static AChunk *ptr2chunk(const void *ptr);
   bool update_hold(int64_t bytes, bool high_prio);
@@ -204,20 +214,30 @@ public:
   inline int64_t get_unmaps()  { return unmaps_; }
   inline int64_t get_large_maps()  { return large_maps_; }
   inline int64_t get_large_unmaps()  { return large_unmaps_; }
+  inline int64_t get_huge_page_maps()  { return huge_page_maps_; }
+  inline int64_t get_huge_page_unmaps()  { return huge_page_unmaps_; }
+  inline int64_t get_huge_page_hold() const { return ATOMIC_LOAD(&huge_page_hold_); }
+  inline int64_t get_huge_free_chunk_count() const { return huge_free_list_.count(); }
   inline int64_t get_shadow_hold() const { return ATOMIC_LOAD(&shadow_hold_); }
 
 private:
   typedef ABitSet ChunkBitMap;
 
 private:
+  AChunk *pop_free_chunk(const bool can_use_huge_page);
+  AChunk *pop_any_free_chunk();
   void *direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
-  void direct_free(const void *ptr, const uint64_t size);
+  void direct_free(const void *ptr, const uint64_t size, const bool huge_page_used = false);
   // wrap for mmap
   void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
   void low_free(const void *ptr, const uint64_t size);
 
 protected:
   AChunkList free_list_;
+  // Chunks backed by huge pages are cached apart so that they are only
+  // handed out again to ctx which are allowed to use huge pages.
+  AChunkList huge_free_list_;
+  int32_t max_chunk_cache_cnt_;
   ChunkBitMap *chunk_bitmap_;
 
   int64_t limit_;
@@ -229,6 +249,9 @@ protected:
   int64_t unmaps_;
   int64_t large_maps_;
   int64_t large_unmaps_;
+  int64_t huge_page_maps_;
+  int64_t huge_page_unmaps_;
+  int64_t huge_page_hold_;
   int64_t shadow_hold_;
 }; // end of class AChunkMgr
 
@@ -279,22 +302,22 @@ inline int64_t AChunkMgr::get_used() const
 
 inline int64_t AChunkMgr::get_free_chunk_count() const
 {
-  return free_list_.count();
+  return free_list_.count() + huge_free_list_.count();
 }
 
 inline int64_t AChunkMgr::get_free_chunk_pushes() const
 {
-  return free_list_.get_pushes();
+  return free_list_.get_pushes() + huge_free_list_.get_pushes();
 }
 
 inline int64_t AChunkMgr::get_free_chunk_pops() const
 {
-  return free_list_.get_pops();
+  return free_list_.get_pops() + huge_free_list_.get_pops();
 }
 
 inline int64_t AChunkMgr::get_freelist_hold() const
 {
-  return free_list_.count() * INTACT_ACHUNK_SIZE;
+  return get_free_chunk_count() * INTACT_ACHUNK_SIZE;
 }
 
 } // end of namespace lib
@@ -34,6 +34,7 @@ ObTenantMemoryMgr::ObTenantMemoryMgr()
   for (uint64_t i = 0; i < common::ObCtxIds::MAX_CTX_ID; i++) {
     ATOMIC_STORE(&(hold_bytes_[i]), 0);
     ATOMIC_STORE(&(limit_bytes_[i]), INT64_MAX);
+    ATOMIC_STORE(&(huge_page_hold_bytes_[i]), 0);
   }
 }
 
@@ -45,6 +46,7 @@ ObTenantMemoryMgr::ObTenantMemoryMgr(const uint64_t tenant_id)
   for (uint64_t i = 0; i < common::ObCtxIds::MAX_CTX_ID; i++) {
     ATOMIC_STORE(&(hold_bytes_[i]), 0);
     ATOMIC_STORE(&(limit_bytes_[i]), INT64_MAX);
+    ATOMIC_STORE(&(huge_page_hold_bytes_[i]), 0);
   }
 }
 void ObTenantMemoryMgr::set_cache_washer(ObICacheWasher &cache_washer)
@@ -98,7 +100,13 @@ AChunk *ObTenantMemoryMgr::alloc_chunk(const int64_t size, const ObMemAttr &attr
         } else {
           chunk = ptr2chunk(washed_blocks);
           const int64_t chunk_hold = static_cast<int64_t>(chunk->hold());
+          ObMemAttr cache_attr;
+          cache_attr.tenant_id_ = tenant_id_;
+          cache_attr.label_ = ObNewModIds::OB_KVSTORE_CACHE_MB;
           update_cache_hold(-chunk_hold);
+          // the washed block changes its owner from kv cache to this ctx
+          update_huge_page_hold(chunk, cache_attr, false);
+          update_huge_page_hold(chunk, attr, true);
           if (!update_ctx_hold(attr.ctx_id_, chunk_hold)) {
             // reach ctx limit
             // The ctx_id here can be given freely, because ctx_id is meaningless when the label is OB_KVSTORE_CACHE_MB
@@ -315,6 +323,21 @@ bool ObTenantMemoryMgr::update_ctx_hold(const uint64_t ctx_id, const int64_t siz
   return updated;
 }
 
+uint64_t ObTenantMemoryMgr::get_chunk_ctx_id(const ObMemAttr &attr)
+{
+  return attr.label_ == ObNewModIds::OB_KVSTORE_CACHE_MB ? ObCtxIds::KVSTORE_CACHE_ID : attr.ctx_id_;
+}
+
+void ObTenantMemoryMgr::update_huge_page_hold(const AChunk *chunk, const ObMemAttr &attr,
+                                              const bool is_alloc)
+{
+  const uint64_t ctx_id = get_chunk_ctx_id(attr);
+  if (NULL != chunk && chunk->is_hugetlb_ && ctx_id < ObCtxIds::MAX_CTX_ID) {
+    const int64_t hold_size = static_cast<int64_t>(chunk->hold());
+    ATOMIC_AAF(&huge_page_hold_bytes_[ctx_id], is_alloc ? hold_size : -hold_size);
+  }
+}
+
 AChunk *ObTenantMemoryMgr::ptr2chunk(void *ptr)
 {
   AChunk *chunk = NULL;
@@ -330,7 +353,9 @@ AChunk *ObTenantMemoryMgr::alloc_chunk_(const int64_t size, const ObMemAttr &att
   if (OB_UNLIKELY(attr.ctx_id_ == ObCtxIds::CO_STACK)) {
     chunk = CHUNK_MGR.alloc_co_chunk(static_cast<uint64_t>(size));
   } else {
-    chunk = CHUNK_MGR.alloc_chunk(static_cast<uint64_t>(size), OB_HIGH_ALLOC == attr.prio_);
+    chunk = CHUNK_MGR.alloc_chunk(static_cast<uint64_t>(size), OB_HIGH_ALLOC == attr.prio_,
+        ObLargePageHelper::can_use_large_page(get_chunk_ctx_id(attr)));
+    update_huge_page_hold(chunk, attr, true);
   }
   return chunk;
 }
@@ -340,6 +365,7 @@ void ObTenantMemoryMgr::free_chunk_(AChunk *chunk, const ObMemAttr &attr)
   if (OB_UNLIKELY(attr.ctx_id_ == ObCtxIds::CO_STACK)) {
     CHUNK_MGR.free_co_chunk(chunk);
   } else {
+    update_huge_page_hold(chunk, attr, false);
     CHUNK_MGR.free_chunk(chunk);
   }
 }
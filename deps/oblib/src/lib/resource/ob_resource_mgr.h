@@ -56,6 +56,8 @@ public:
 
   void update_rpc_hold(const int64_t size) { ATOMIC_AAF(&rpc_hold_, size); }
   const volatile int64_t *get_ctx_hold_bytes() const { return hold_bytes_; }
+  // bytes of chunks backed by huge pages, kv cache blocks are counted on KVSTORE_CACHE_ID
+  const volatile int64_t *get_ctx_huge_page_hold_bytes() const { return huge_page_hold_bytes_; }
   inline static int64_t align(const int64_t size)
   {
     return static_cast<int64_t>(CHUNK_MGR.aligned(static_cast<uint64_t>(size)));
@@ -68,6 +70,8 @@ public:
 private:
   void update_cache_hold(const int64_t size);
   bool update_ctx_hold(const uint64_t ctx_id, const int64_t size);
+  void update_huge_page_hold(const AChunk *chunk, const ObMemAttr &attr, const bool is_alloc);
+  static uint64_t get_chunk_ctx_id(const ObMemAttr &attr);
   AChunk *ptr2chunk(void *ptr);
   AChunk *alloc_chunk_(const int64_t size, const ObMemAttr &attr);
   void free_chunk_(AChunk *chunk, const ObMemAttr &attr);
@@ -80,6 +84,7 @@ private:
   int64_t cache_item_count_;
   volatile int64_t hold_bytes_[common::ObCtxIds::MAX_CTX_ID];
   volatile int64_t limit_bytes_[common::ObCtxIds::MAX_CTX_ID];
+  volatile int64_t huge_page_hold_bytes_[common::ObCtxIds::MAX_CTX_ID];
 };
 
 struct ObTenantResourceMgr : public common::ObLink
@@ -91,6 +91,39 @@ ssize_t get_stack_trace_inplace(unw_context_t *context, unw_cursor_t *cursor,
   return count;
 }
 
+int safe_backtrace_in_signal(uintptr_t *addrs, int64_t max_cnt, int64_t *cnt)
+{
+  int ret = 0;
+  unw_context_t context;
+  unw_cursor_t cursor;
+  *cnt = 0;
+  if (unw_getcontext(&context) < 0) {
+    ret = -1;
+  } else if (unw_init_local(&cursor, &context) < 0) {
+    ret = -1;
+  } else {
+    int in_handler = 1;
+    int r = 1;
+    while (r > 0 && *cnt < max_cnt) {
+      if (in_handler) {
+        // the sigreturn trampoline separates handler frames from interrupted ones
+        if (unw_is_signal_frame(&cursor) > 0) {
+          in_handler = 0;
+        }
+      } else if (!get_frame_info(&cursor, &addrs[*cnt])) {
+        break;
+      } else {
+        ++*cnt;
+      }
+      r = unw_step(&cursor);
+    }
+    if (in_handler) {
+      ret = -1;
+    }
+  }
+  return ret;
+}
+
 int8_t get_frame_info(unw_cursor_t *cursor, uintptr_t *ip)
 {
   unw_word_t uip;
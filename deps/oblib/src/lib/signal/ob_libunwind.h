@@ -18,6 +18,9 @@
 
 EXTERN_C_BEGIN
 extern int safe_backtrace(char *buf, int64_t len, int64_t *pos);
+// collect raw return addresses of the frames interrupted by the signal which
+// is being handled, frames of the handler itself are skipped.
+extern int safe_backtrace_in_signal(uintptr_t *addrs, int64_t max_cnt, int64_t *cnt);
 EXTERN_C_END
 
 #endif
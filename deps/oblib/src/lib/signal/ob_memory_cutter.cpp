@@ -42,18 +42,20 @@ void ObMemoryCutter::free_chunk(const void *ptr, const uint64_t size)
 void ObMemoryCutter::free_chunk(int64_t &total_size)
 {
   auto &mgr = AChunkMgr::instance();
-  auto &free_list = mgr.free_list_;
-  AChunk *head = free_list.header_;
-  while (head) {
-    if (head->is_valid()) {
-      AChunk *next = head->next_;
-      uint64_t all_size = chunk_size(head);
-      free_chunk(head, all_size);
-      total_size += all_size;
-      head = next;
-    } else {
-      DLOG(WARN, "invalid chunk magic");
-      break;
+  AChunkList *free_lists[] = {&mgr.free_list_, &mgr.huge_free_list_};
+  for (int64_t i = 0; i < ARRAYSIZEOF(free_lists); i++) {
+    AChunk *head = free_lists[i]->header_;
+    while (head) {
+      if (head->is_valid()) {
+        AChunk *next = head->next_;
+        uint64_t all_size = chunk_size(head);
+        free_chunk(head, all_size);
+        total_size += all_size;
+        head = next;
+      } else {
+        DLOG(WARN, "invalid chunk magic");
+        break;
+      }
     }
   }
 }
@@ -34,7 +34,8 @@ ObLatchStat::ObLatchStat()
     immediate_gets_(0),
     immediate_misses_(0),
     spin_gets_(0),
-    wait_time_(0)
+    wait_time_(0),
+    wait_time_hist_()
 {
 }
 
@@ -54,6 +55,9 @@ int ObLatchStat::add(const ObLatchStat &other)
   immediate_misses_ += other.immediate_misses_;
   spin_gets_ += other.spin_gets_;
   wait_time_ += other.wait_time_;
+  for (int64_t i = 0; i < WAIT_TIME_HIST_BUCKET_CNT; ++i) {
+    wait_time_hist_[i] += other.wait_time_hist_[i];
+  }
   return ret;
 }
 
@@ -70,6 +74,20 @@ void ObLatchStat::reset()
   immediate_misses_ = 0;
   spin_gets_ = 0;
   wait_time_ = 0;
+  MEMSET(wait_time_hist_, 0, sizeof(wait_time_hist_));
+}
+
+int64_t ObLatchStat::print_wait_time_hist(char *buf, const int64_t buf_len) const
+{
+  static const char *BUCKET_NAMES[WAIT_TIME_HIST_BUCKET_CNT] = {
+    "<10us", "<100us", "<1ms", "<10ms", "<100ms", ">=100ms"
+  };
+  int64_t pos = 0;
+  for (int64_t i = 0; i < WAIT_TIME_HIST_BUCKET_CNT; ++i) {
+    (void)databuff_printf(buf, buf_len, pos, "%s%s:%lu",
+                          0 == i ? "" : ",", BUCKET_NAMES[i], wait_time_hist_[i]);
+  }
+  return pos;
 }
 
 /**
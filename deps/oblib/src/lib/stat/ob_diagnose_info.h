@@ -31,9 +31,20 @@ typedef ObStatArray<ObStatEventSetStat, ObStatEventIds::STAT_EVENT_SET_END - ObS
 
 struct ObLatchStat
 {
+  // wait time buckets: [0, 10us), [10us, 100us), [100us, 1ms), [1ms, 10ms), [10ms, 100ms), [100ms, +inf)
+  static const int64_t WAIT_TIME_HIST_BUCKET_CNT = 6;
   ObLatchStat();
   int add(const ObLatchStat &other);
   void reset();
+  int64_t print_wait_time_hist(char *buf, const int64_t buf_len) const;
+  static inline int64_t get_wait_time_hist_idx(const int64_t wait_time_us)
+  {
+    int64_t idx = 0;
+    for (int64_t bound = 10; idx < WAIT_TIME_HIST_BUCKET_CNT - 1 && wait_time_us >= bound; bound *= 10) {
+      ++idx;
+    }
+    return idx;
+  }
   uint64_t addr_;
   uint64_t id_;
   uint64_t level_;
@@ -45,6 +56,7 @@ struct ObLatchStat
   uint64_t immediate_misses_;
   uint64_t spin_gets_;
   uint64_t wait_time_;
+  uint64_t wait_time_hist_[WAIT_TIME_HIST_BUCKET_CNT];
 };
 
 struct ObLatchStatArray
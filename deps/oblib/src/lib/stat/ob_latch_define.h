@@ -15,7 +15,7 @@ LATCH_DEF(LATCH_WAIT_QUEUE_LOCK, 0, "latch wait queue lock", LATCH_FIFO, 2000, 0
 LATCH_DEF(DEFAULT_SPIN_LOCK, 1, "default spin lock", LATCH_FIFO, 2000, 0, DEFAULT_SPIN_LOCK_WAIT, "default spin lock")
 LATCH_DEF(DEFAULT_SPIN_RWLOCK, 2, "default spin rwlock", LATCH_FIFO, 2000, 0, DEFAULT_SPIN_RWLOCK_WAIT, "default spin rwlock")
 LATCH_DEF(DEFAULT_MUTEX, 3, "default mutex", LATCH_FIFO, 2000, 0, DEFAULT_MUTEX_WAIT, "default mutex")
-LATCH_DEF(KV_CACHE_BUCKET_LOCK, 4, "kv cache bucket latch", LATCH_FIFO, 2000, 0, KV_CACHE_BUCKET_LOCK_WAIT, "kv cache bucket latch")
+LATCH_DEF(KV_CACHE_BUCKET_LOCK, 4, "kv cache bucket latch", LATCH_QUEUED, 2000, 0, KV_CACHE_BUCKET_LOCK_WAIT, "kv cache bucket latch")
 LATCH_DEF(TIME_WHEEL_TASK_LOCK, 5, "time wheel task latch", LATCH_FIFO, 2000, 0, TIME_WHEEL_TASK_LOCK_WAIT, "time wheel task latch")
 LATCH_DEF(TIME_WHEEL_BUCKET_LOCK, 6, "time wheel bucket latch", LATCH_FIFO, 2000, 0, TIME_WHEEL_BUCKET_LOCK_WAIT, "time wheel bucket latch")
 LATCH_DEF(ELECTION_LOCK, 7, "election latch", LATCH_FIFO, 20000000L, 0, ELECTION_LOCK_WAIT, "election latch")
@@ -177,7 +177,10 @@ struct ObLatchPolicy
   enum ObLatchPolicyEnum
   {
     LATCH_READ_PREFER = 0,
-    LATCH_FIFO
+    LATCH_FIFO,
+    // FIFO, and once waiters are queued new comers join the wait queue instead of
+    // polling the latch word, queued waiters spin on their own wait word before sleeping
+    LATCH_QUEUED
   };
 };
 
@@ -360,7 +360,6 @@ int ObMySQLUtil::int_cell_str(
       }
       /* skip bytes_to_store_len bytes to store length */
       int64_t bytes_to_store_len = get_number_store_len(length);
-      MEMCPY(buf + pos + bytes_to_store_len, ffi.ptr(), ffi.length());
       if (zero_cnt > 0) {
         /*zero_cnt > 0 indicates that zerofill is true */
         MEMSET(buf + pos + bytes_to_store_len, '0', zero_cnt);
@@ -290,12 +290,15 @@ private:
   int do_write(int fd, const char* buf, int64_t sz, int64_t& consume_bytes) {
     int ret = OB_SUCCESS;
     int64_t pos = 0;
-    while(pos < sz && OB_SUCCESS == ret) {
+    bool is_blocked = false;
+    while(pos < sz && OB_SUCCESS == ret && !is_blocked) {
       int64_t wbytes = 0;
       if ((wbytes = write(fd, buf + pos, sz - pos)) >= 0) {
         pos += wbytes;
       } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
-        LOG_INFO("write return EAGAIN");
+        // socket buffer is full, leave the rest to EPOLLOUT instead of spinning
+        is_blocked = true;
+        LOG_DEBUG("write return EAGAIN", K(pos), K(sz));
       } else if (EINTR == errno) {
         // pass
       } else {
@@ -346,6 +349,17 @@ public:
   void init_write_task(const char* buf, int64_t sz) {
     pending_write_task_.init(buf, sz);
   }
+  // called by worker thread before handing the write to epoll thread. A partial
+  // write advances pending_write_task_ past the bytes already sent, the epoll
+  // thread resumes from there. On IO error the task is left as is, the epoll
+  // thread retries it and handles the error.
+  int try_write_directly(bool& become_clean) {
+    int ret = OB_SUCCESS;
+    if (OB_SUCC(pending_write_task_.try_write(fd_, become_clean)) && become_clean) {
+      last_write_time_ = ObTimeUtility::current_time();
+    }
+    return ret;
+  }
 
   bool is_need_epoll_trigger_write() const { return need_epoll_trigger_write_; }
   int do_pending_write(bool& become_clean) {
@@ -595,6 +609,18 @@ public:
     write_req_queue_.push(&s->write_task_link_);
     evfd_.signal();
   }
+  // most responses fit in socket buffer, write them in worker thread to save
+  // the eventfd signal and epoll wakeup, fallback to epoll thread otherwise.
+  void async_write(ObSqlSock* s) {
+    bool become_clean = false;
+    if (OB_LIKELY(!s->has_error())
+        && OB_SUCCESS == s->try_write_directly(become_clean)
+        && become_clean) {
+      handler_.on_flushed(s->sess_);
+    } else {
+      push_write_req(s);
+    }
+  }
   void revert_sock(ObSqlSock* s) {
     if (OB_UNLIKELY(s->has_error())) {
       LOG_TRACE("revert_sock: sock has error", K(*s));
@@ -939,7 +965,7 @@ void ObSqlNio::async_write_data(void* sess, const char* buf, int64_t sz)
 {
   ObSqlSock* sock = sess2sock(sess);
   sock->init_write_task(buf, sz);
-  sock->get_nio_impl().push_write_req(sock);
+  sock->get_nio_impl().async_write(sock);
 }
 
 }; // end namespace obmysql
@@ -14,6 +14,7 @@
 #define private public
 #define protected public
 #include "lib/resource/achunk_mgr.h"
+#include "lib/allocator/ob_mod_define.h"
 #undef protected
 #undef private
 
@@ -37,6 +38,18 @@ public:
   virtual void TearDown()
   {
   }
+
+  // there may be no hugetlb pages on the test machine, pretend the chunk got one
+  AChunk *alloc_huge_chunk()
+  {
+    AChunk *chunk = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, true);
+    if (nullptr != chunk && !chunk->is_hugetlb_) {
+      chunk->is_hugetlb_ = true;
+      huge_page_maps_++;
+      huge_page_hold_ += chunk->aligned();
+    }
+    return chunk;
+  }
 };
 
 
@@ -82,3 +95,103 @@ TEST_F(TestChunkMgr, FreeListManyChunk)
   EXPECT_EQ(500*2, free_list_.get_pushes());
   EXPECT_EQ(500, free_list_.get_pops());
 }
+
+TEST_F(TestChunkMgr, HugeFreeList)
+{
+  AChunk *huge_chunk = alloc_huge_chunk();
+  ASSERT_TRUE(NULL != huge_chunk);
+  free_chunk(huge_chunk);
+  EXPECT_EQ(1, huge_free_list_.count());
+  EXPECT_EQ(0, free_list_.count());
+  EXPECT_EQ(1, get_free_chunk_count());
+
+  // a ctx without large pages must not get the cached huge page chunk
+  AChunk *chunk = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, false);
+  ASSERT_TRUE(NULL != chunk);
+  EXPECT_NE(huge_chunk, chunk);
+  EXPECT_FALSE(chunk->is_hugetlb_);
+  EXPECT_EQ(1, huge_free_list_.count());
+  free_chunk(chunk);
+  EXPECT_EQ(1, free_list_.count());
+
+  // a ctx with large pages prefers the huge page chunk
+  chunk = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, true);
+  EXPECT_EQ(huge_chunk, chunk);
+  EXPECT_TRUE(chunk->is_hugetlb_);
+  EXPECT_EQ(0, huge_free_list_.count());
+
+  // and falls back to a normal chunk once no huge page chunk is cached
+  AChunk *chunk2 = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, true);
+  ASSERT_TRUE(NULL != chunk2);
+  EXPECT_EQ(0, free_list_.count());
+  EXPECT_EQ(0, get_free_chunk_count());
+
+  set_max_chunk_cache_cnt(0);
+  free_chunk(chunk);
+  free_chunk(chunk2);
+  EXPECT_EQ(0, get_free_chunk_count());
+  EXPECT_EQ(1, get_huge_page_unmaps());
+  EXPECT_EQ(0, get_huge_page_hold());
+}
+
+TEST_F(TestChunkMgr, FreeListTotalLimit)
+{
+  const int cache_cnt = 4;
+  set_max_chunk_cache_cnt(cache_cnt);
+  AChunk *huge_chunks[cache_cnt] = {};
+  AChunk *chunks[cache_cnt] = {};
+  for (int i = 0; i < cache_cnt; i++) {
+    huge_chunks[i] = alloc_huge_chunk();
+    chunks[i] = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, false);
+    ASSERT_TRUE(NULL != huge_chunks[i]);
+    ASSERT_TRUE(NULL != chunks[i]);
+  }
+  for (int i = 0; i < cache_cnt; i++) {
+    free_chunk(huge_chunks[i]);
+    free_chunk(chunks[i]);
+  }
+  // both lists share the budget
+  EXPECT_EQ(cache_cnt, get_free_chunk_count());
+  EXPECT_EQ(cache_cnt / 2, huge_free_list_.count());
+  EXPECT_EQ(cache_cnt / 2, free_list_.count());
+  EXPECT_EQ(cache_cnt * static_cast<int64_t>(INTACT_ACHUNK_SIZE), get_freelist_hold());
+}
+
+TEST(TestLargePageHelper, CtxParam)
+{
+  const uint64_t kv_id = ObCtxIds::KVSTORE_CACHE_ID;
+  const uint64_t memstore_id = ObCtxIds::MEMSTORE_CTX_ID;
+  const uint64_t default_id = ObCtxIds::DEFAULT_CTX_ID;
+
+  // all ctx by default
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(default_id));
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(kv_id));
+  EXPECT_FALSE(ObLargePageHelper::can_use_large_page(ObCtxIds::MAX_CTX_ID));
+
+  ObLargePageHelper::set_ctx_param("KVSTORE_CACHE_ID,MEMSTORE_CTX_ID");
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(kv_id));
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(memstore_id));
+  EXPECT_FALSE(ObLargePageHelper::can_use_large_page(default_id));
+
+  // blanks are separators too, unknown names are skipped
+  ObLargePageHelper::set_ctx_param(" MEMSTORE_CTX_ID, NO_SUCH_CTX ");
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(memstore_id));
+  EXPECT_FALSE(ObLargePageHelper::can_use_large_page(kv_id));
+
+  // nothing valid in the list, no ctx may use large pages
+  ObLargePageHelper::set_ctx_param("NO_SUCH_CTX");
+  EXPECT_FALSE(ObLargePageHelper::can_use_large_page(memstore_id));
+  EXPECT_FALSE(ObLargePageHelper::can_use_large_page(default_id));
+
+  ObLargePageHelper::set_ctx_param("ALL");
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(default_id));
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(kv_id));
+
+  ObLargePageHelper::set_ctx_param("KVSTORE_CACHE_ID");
+  ObLargePageHelper::set_ctx_param("");
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(default_id));
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(memstore_id));
+
+  ObLargePageHelper::set_ctx_param(NULL);
+  EXPECT_TRUE(ObLargePageHelper::can_use_large_page(default_id));
+}
@@ -14,11 +14,14 @@
 #include "lib/resource/achunk_mgr.h"
 #include "lib/resource/ob_resource_mgr.h"
 #include "lib/alloc/object_mgr.h"
+#include "lib/alloc/ob_tenant_ctx_allocator.h"
 #undef private
 #include "lib/allocator/ob_malloc.h"
 #include "lib/utility/ob_test_util.h"
 #include "lib/coro/testing.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -280,3 +283,170 @@ TEST_F(TestObjectMgr, TestSubObjectMgr)
     rec++;
   }
 }
+
+static int64_t magazine_cached_cnt(ObjectMgr &om)
+{
+  int64_t cnt = 0;
+  for (int i = 0; i < ObjectMgr::MAGAZINE_CNT; i++) {
+    ObjectMagazine *magazine = om.magazines_[i];
+    if (magazine != nullptr) {
+      for (uint32_t cls = 0; cls <= ObjectMagazine::MAX_CACHED_CELLS; cls++) {
+        cnt += magazine->cnts_[cls];
+      }
+    }
+  }
+  return cnt;
+}
+
+TEST_F(TestObjectMgr, TestMagazineCache)
+{
+  ObTenantCtxAllocator ta(1001, ObCtxIds::DEFAULT_CTX_ID);
+  ta.set_tenant_memory_mgr();
+  ta.set_limit(INT64_MAX);
+  ObMemAttr attr(1001, "Magazine", ObCtxIds::DEFAULT_CTX_ID);
+  ObjectMgr &om = ta.obj_mgr_;
+
+  void *p = ta.alloc(64, attr);
+  ASSERT_TRUE(NULL != p);
+  AObject *obj = reinterpret_cast<AObject*>((char*)p - AOBJECT_HEADER_SIZE);
+  const int64_t used = om.get_stat().used_;
+  ta.free(p);
+  // cached, still in use in its ObjectSet
+  ASSERT_EQ(1, magazine_cached_cnt(om));
+  ASSERT_TRUE(obj->in_magazine_);
+  ASSERT_TRUE(obj->in_use_);
+  ASSERT_EQ(used, om.get_stat().used_);
+
+  // another size is not served from the cached object
+  void *q = ta.alloc(48, attr);
+  ASSERT_TRUE(NULL != q);
+  ASSERT_NE(p, q);
+  ta.free(q);
+  ASSERT_EQ(2, magazine_cached_cnt(om));
+
+  // same size is
+  void *r = ta.alloc(64, attr);
+  ASSERT_EQ(p, r);
+  ASSERT_FALSE(obj->in_magazine_);
+  ASSERT_EQ(0, STRCMP("Magazine", obj->label_));
+  ASSERT_EQ(1, magazine_cached_cnt(om));
+  ta.free(r);
+  om.flush_magazines();
+  ASSERT_EQ(0, magazine_cached_cnt(om));
+}
+
+TEST_F(TestObjectMgr, TestMagazineFlush)
+{
+  ObTenantCtxAllocator ta(1002, ObCtxIds::DEFAULT_CTX_ID);
+  ta.set_tenant_memory_mgr();
+  ta.set_limit(INT64_MAX);
+  ObMemAttr attr(1002, "Magazine", ObCtxIds::DEFAULT_CTX_ID);
+  ObjectMgr &om = ta.obj_mgr_;
+  const int64_t cnt = ObjectMagazine::CAPACITY + 1;
+  void *ptrs[cnt];
+
+  const int64_t used_before = om.get_stat().used_;
+  for (int64_t i = 0; i < cnt; i++) {
+    ptrs[i] = ta.alloc(128, attr);
+    ASSERT_TRUE(NULL != ptrs[i]);
+  }
+  const int64_t used_after_alloc = om.get_stat().used_;
+  ASSERT_GT(used_after_alloc, used_before);
+  for (int64_t i = 0; i < ObjectMagazine::CAPACITY; i++) {
+    ta.free(ptrs[i]);
+  }
+  ASSERT_EQ(ObjectMagazine::CAPACITY, magazine_cached_cnt(om));
+  ASSERT_EQ(used_after_alloc, om.get_stat().used_);
+
+  // the size class is full, its older half goes back to the ObjectSet
+  ta.free(ptrs[cnt - 1]);
+  ASSERT_EQ(ObjectMagazine::CAPACITY / 2 + 1, magazine_cached_cnt(om));
+  ASSERT_LT(om.get_stat().used_, used_after_alloc);
+
+  // wash flushes everything
+  ta.sync_wash(0);
+  ASSERT_EQ(0, magazine_cached_cnt(om));
+  ASSERT_EQ(used_before, om.get_stat().used_);
+}
+
+TEST_F(TestObjectMgr, TestMagazineFreeAfterDelete)
+{
+  ObTenantCtxAllocator ta(1003, ObCtxIds::DEFAULT_CTX_ID);
+  ta.set_tenant_memory_mgr();
+  ta.set_limit(INT64_MAX);
+  ObMemAttr attr(1003, "Magazine", ObCtxIds::DEFAULT_CTX_ID);
+  ObjectMgr &om = ta.obj_mgr_;
+
+  const int64_t used_before = om.get_stat().used_;
+  void *p = ta.alloc(64, attr);
+  void *q = ta.alloc(64, attr);
+  ASSERT_TRUE(NULL != p && NULL != q);
+  ta.free(p);
+  ASSERT_EQ(1, magazine_cached_cnt(om));
+
+  // deleting the tenant flushes the magazines
+  ta.set_tenant_deleted();
+  ASSERT_EQ(0, magazine_cached_cnt(om));
+
+  // and later frees bypass them
+  ta.free(q);
+  ASSERT_EQ(0, magazine_cached_cnt(om));
+  ASSERT_EQ(used_before, om.get_stat().used_);
+}
+
+TEST_F(TestObjectMgr, TestMagazineDoubleFree)
+{
+  ObTenantCtxAllocator ta(1004, ObCtxIds::DEFAULT_CTX_ID);
+  ta.set_tenant_memory_mgr();
+  ta.set_limit(INT64_MAX);
+  ObMemAttr attr(1004, "Magazine", ObCtxIds::DEFAULT_CTX_ID);
+  ObjectMgr &om = ta.obj_mgr_;
+
+  void *p = ta.alloc(64, attr);
+  ASSERT_TRUE(NULL != p);
+  ta.free(p);
+  ASSERT_EQ(1, magazine_cached_cnt(om));
+  // the cached object is still in use in its ObjectSet, a second free must abort anyway
+  ASSERT_DEATH(ta.free(p), "");
+  ASSERT_EQ(1, magazine_cached_cnt(om));
+  om.flush_magazines();
+  ASSERT_EQ(0, magazine_cached_cnt(om));
+}
+
+TEST_F(TestObjectMgr, TestMagazineFreeRaceWithDelete)
+{
+  const int64_t thread_cnt = 4;
+  const int64_t obj_cnt = 2000;
+  for (int64_t round = 0; round < 20; round++) {
+    ObTenantCtxAllocator ta(1005, ObCtxIds::DEFAULT_CTX_ID);
+    ta.set_tenant_memory_mgr();
+    ta.set_limit(INT64_MAX);
+    ObMemAttr attr(1005, "Magazine", ObCtxIds::DEFAULT_CTX_ID);
+    ObjectMgr &om = ta.obj_mgr_;
+    const int64_t used_before = om.get_stat().used_;
+    std::vector<void*> ptrs[thread_cnt];
+    for (int64_t i = 0; i < thread_cnt; i++) {
+      for (int64_t j = 0; j < obj_cnt; j++) {
+        void *p = ta.alloc(32 + (j % 8) * 16, attr);
+        ASSERT_TRUE(NULL != p);
+        ptrs[i].push_back(p);
+      }
+    }
+    // frees run while the tenant is deleted, none of them may stay parked in a magazine
+    std::vector<std::thread> threads;
+    for (int64_t i = 0; i < thread_cnt; i++) {
+      threads.push_back(std::thread([&ta, &ptrs, i]() {
+        for (void *p : ptrs[i]) {
+          ta.free(p);
+        }
+      }));
+    }
+    ::usleep(static_cast<useconds_t>(round * 50));
+    ta.set_tenant_deleted();
+    for (auto &th : threads) {
+      th.join();
+    }
+    ASSERT_EQ(0, magazine_cached_cnt(om)) << "round " << round;
+    ASSERT_EQ(used_before, om.get_stat().used_) << "round " << round;
+  }
+}
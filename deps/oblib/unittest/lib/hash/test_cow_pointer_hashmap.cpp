@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "gtest/gtest.h"
+#include "lib/hash/ob_cow_pointer_hashmap.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace hash;
+
+struct PairValue
+{
+  int64_t key_;
+  int64_t value_;
+
+  PairValue() : key_(0), value_(0) {}
+  PairValue(const int64_t key, const int64_t value) : key_(key), value_(value) {}
+
+  int64_t get_key() const
+  {
+    return key_;
+  }
+};
+
+template <class K, class V>
+struct GetKey
+{
+  K operator()(const V value) const
+  {
+    return value->get_key();
+  }
+};
+
+typedef ObCowPointerHashMap<int64_t, PairValue *, GetKey> CowMap;
+
+TEST(TestObCowPointerHashMap, basic_test)
+{
+  CowMap hashmap;
+  PairValue val1(1, 1);
+  PairValue val2(2, 2);
+  PairValue *val = NULL;
+  ASSERT_EQ(OB_SUCCESS, hashmap.init());
+  ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.get_refactored(1, val));
+  ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(1, &val1));
+  ASSERT_EQ(OB_HASH_EXIST, hashmap.set_refactored(1, &val1));
+  ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(1, &val1, 1));
+  ASSERT_EQ(OB_SUCCESS, hashmap.get_refactored(1, val));
+  ASSERT_EQ(1, val->value_);
+  ASSERT_EQ(1, (*hashmap.get(1))->value_);
+  ASSERT_EQ(1, hashmap.item_count());
+
+  ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(2, &val2));
+  ASSERT_EQ(2, hashmap.item_count());
+  ASSERT_EQ(OB_SUCCESS, hashmap.erase_refactored(2L));
+  ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.erase_refactored(2L));
+  ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.get_refactored(2, val));
+  ASSERT_EQ(1, hashmap.item_count());
+
+  hashmap.clear();
+  ASSERT_EQ(0, hashmap.count());
+  ASSERT_EQ(0, hashmap.item_count());
+}
+
+TEST(TestObCowPointerHashMap, test_extend)
+{
+  CowMap hashmap;
+  const int64_t pair_count = 300000;
+  PairValue *pairs = new PairValue[pair_count];
+  PairValue *val = NULL;
+  for (int64_t i = 0; i < pair_count; ++i) {
+    pairs[i].key_ = i;
+    pairs[i].value_ = i;
+    ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(pairs[i].key_, &pairs[i]));
+  }
+  ASSERT_EQ(pair_count, hashmap.item_count());
+  for (int64_t i = 0; i < pair_count; i += 100) {
+    ASSERT_EQ(OB_SUCCESS, hashmap.erase_refactored(pairs[i].key_));
+  }
+  ASSERT_EQ(pair_count - pair_count / 100, hashmap.item_count());
+  for (int64_t i = 0; i < pair_count; ++i) {
+    if (0 == i % 100) {
+      ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.get_refactored(pairs[i].key_, val));
+    } else {
+      ASSERT_EQ(OB_SUCCESS, hashmap.get_refactored(pairs[i].key_, val));
+      ASSERT_EQ(i, val->value_);
+    }
+  }
+  delete [] pairs;
+}
+
+TEST(TestObCowPointerHashMap, test_copy_on_write)
+{
+  const int64_t pair_count = 10000;
+  PairValue *pairs = new PairValue[pair_count];
+  PairValue other(0, -1);
+  PairValue *val = NULL;
+  CowMap *base = new CowMap();
+  for (int64_t i = 0; i < pair_count; ++i) {
+    pairs[i].key_ = i;
+    pairs[i].value_ = i;
+    ASSERT_EQ(OB_SUCCESS, base->set_refactored(pairs[i].key_, &pairs[i]));
+  }
+
+  // the copy shares all chunks
+  CowMap copy;
+  ASSERT_EQ(OB_SUCCESS, copy.assign(*base));
+  ASSERT_EQ(pair_count, copy.item_count());
+  ASSERT_EQ(base->shared_chunk_count(), copy.shared_chunk_count());
+  const int64_t chunk_count = copy.shared_chunk_count();
+  ASSERT_LT(0, chunk_count);
+
+  // changing one key of the copy clones one chunk only and leaves the base unchanged
+  ASSERT_EQ(OB_SUCCESS, copy.set_refactored(0, &other, 1));
+  ASSERT_EQ(chunk_count - 1, copy.shared_chunk_count());
+  ASSERT_EQ(OB_SUCCESS, copy.get_refactored(0, val));
+  ASSERT_EQ(-1, val->value_);
+  ASSERT_EQ(OB_SUCCESS, base->get_refactored(0, val));
+  ASSERT_EQ(0, val->value_);
+
+  // erasing a missing key does not clone
+  ASSERT_EQ(OB_HASH_NOT_EXIST, copy.erase_refactored(pair_count));
+  ASSERT_EQ(chunk_count - 1, copy.shared_chunk_count());
+  ASSERT_EQ(OB_SUCCESS, copy.erase_refactored(1L));
+  ASSERT_EQ(OB_HASH_NOT_EXIST, copy.get_refactored(1, val));
+  ASSERT_EQ(OB_SUCCESS, base->get_refactored(1, val));
+  ASSERT_EQ(1, val->value_);
+
+  // the copy is still valid after the base is released
+  delete base;
+  base = NULL;
+  ASSERT_EQ(0, copy.shared_chunk_count());
+  ASSERT_EQ(pair_count - 1, copy.item_count());
+  for (int64_t i = 2; i < pair_count; ++i) {
+    ASSERT_EQ(OB_SUCCESS, copy.get_refactored(pairs[i].key_, val));
+    ASSERT_EQ(i, val->value_);
+  }
+  delete [] pairs;
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -293,6 +293,48 @@ TEST(ObLatch,wr2rdlock)
   stress.wait();
 }
 
+class QueuedRWLock : public RWLockWithTimeout
+{
+public:
+  explicit QueuedRWLock(bool has_timeout)
+      : RWLockWithTimeout(has_timeout, ObLatchIds::KV_CACHE_BUCKET_LOCK)
+  {
+  }
+};
+
+TEST(ObLatch, queued_wr_contend)
+{
+  ASSERT_EQ(ObLatchPolicy::LATCH_QUEUED, OB_LATCHES[ObLatchIds::KV_CACHE_BUCKET_LOCK].policy_);
+  k_rd = 0;
+  TestRWLockContend<QueuedRWLock> stress;
+  stress.set_thread_count(MAX_RW_TH);
+  // every cycle takes the write lock
+  stress.set_param(RWLockTestParam(cycles, 1, 0, w_loads[0]));
+  stress.start();
+  stress.wait();
+  ASSERT_EQ(cycles * MAX_RW_TH, k_rd);
+}
+
+TEST(ObLatch, queued_rw_contend)
+{
+  k_rd = 0;
+  TestRWLockContend<QueuedRWLock> stress;
+  stress.set_thread_count(MAX_RW_TH);
+  stress.set_param(RWLockTestParam(cycles, ratios[0], r_loads[0], w_loads[0], 2));
+  stress.start();
+  stress.wait();
+  ASSERT_EQ(cycles * MAX_RW_TH / ratios[0], k_rd);
+}
+
+TEST(ObLatch, queued_timeout)
+{
+  TestRWLockContend<QueuedRWLock> stress(true);
+  stress.set_thread_count(10);
+  stress.set_param(RWLockTestParam(100, 2, 10, 1000));
+  stress.start();
+  stress.wait();
+}
+
 TEST(ObLatch, invaid_unlock)
 {
   lib::ObMutex mutex;
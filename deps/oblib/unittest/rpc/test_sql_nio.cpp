@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "rpc/obmysql/ob_sql_nio.h"
+#include "rpc/obmysql/ob_i_sql_sock_handler.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/time/ob_time_utility.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+
+class TestSqlSockHandler : public ObISqlSockHandler
+{
+public:
+  // keep the server send buffer small so that large responses hit EAGAIN
+  static const int SERVER_SNDBUF = 4096;
+  TestSqlSockHandler(): sess_(NULL), flushed_count_(0) {}
+  virtual ~TestSqlSockHandler() {}
+  virtual int on_readable(void* sess) { UNUSED(sess); return 0; }
+  virtual void on_close(void* sess, int err) { UNUSED(sess); UNUSED(err); }
+  virtual void on_flushed(void* sess) { UNUSED(sess); ATOMIC_INC(&flushed_count_); }
+  virtual int on_connect(void* sess, int fd)
+  {
+    int sndbuf = SERVER_SNDBUF;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+    ATOMIC_STORE(&sess_, sess);
+    return 0;
+  }
+  void* get_sess() const { return ATOMIC_LOAD(&sess_); }
+  int64_t get_flushed_count() const { return ATOMIC_LOAD(&flushed_count_); }
+private:
+  void* sess_;
+  int64_t flushed_count_;
+};
+
+class TestSqlNio : public ::testing::Test
+{
+public:
+  static const int64_t WAIT_TIMEOUT_US = 10 * 1000 * 1000;
+  TestSqlNio(): client_fd_(-1) {}
+  virtual void SetUp()
+  {
+    // the listen fd of a stopped nio stays open, every test listens on its own port
+    static int port_seq = 0;
+    const int port = 30000 + static_cast<int>((getpid() * 8 + port_seq++) % 30000);
+    ASSERT_EQ(OB_SUCCESS, nio_.start(port, &handler_, 1));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    int rcvbuf = TestSqlSockHandler::SERVER_SNDBUF;
+    ASSERT_LE(0, client_fd_ = socket(AF_INET, SOCK_STREAM, 0));
+    ASSERT_EQ(0, setsockopt(client_fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)));
+    ASSERT_EQ(0, connect(client_fd_, (struct sockaddr*)&addr, sizeof(addr)));
+    const int64_t start_ts = ObTimeUtility::current_time();
+    while (NULL == handler_.get_sess() && ObTimeUtility::current_time() - start_ts < WAIT_TIMEOUT_US) {
+      usleep(1000);
+    }
+    ASSERT_TRUE(NULL != handler_.get_sess());
+  }
+  virtual void TearDown()
+  {
+    // stop the epoll thread before the peer goes away, the test session has
+    // no sql session behind it to disconnect
+    nio_.stop();
+    nio_.wait();
+    if (client_fd_ >= 0) {
+      close(client_fd_);
+      client_fd_ = -1;
+    }
+  }
+  static char pattern(const int64_t pos) { return static_cast<char>(pos * 7 % 251); }
+  void fill(char* buf, const int64_t sz)
+  {
+    for (int64_t i = 0; i < sz; i++) {
+      buf[i] = pattern(i);
+    }
+  }
+  // read exactly sz bytes and check that they arrive in order
+  void read_and_check(const int64_t sz)
+  {
+    const int64_t read_buf_size = 64 * 1024;
+    char read_buf[read_buf_size];
+    int64_t pos = 0;
+    while (pos < sz) {
+      const int64_t rbytes = read(client_fd_, read_buf, std::min(read_buf_size, sz - pos));
+      ASSERT_LT(0, rbytes) << "pos=" << pos << " errno=" << errno;
+      for (int64_t i = 0; i < rbytes; i++) {
+        ASSERT_EQ(pattern(pos + i), read_buf[i]) << "pos=" << pos + i;
+      }
+      pos += rbytes;
+    }
+  }
+  void wait_flushed(const int64_t count)
+  {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    while (handler_.get_flushed_count() < count
+           && ObTimeUtility::current_time() - start_ts < WAIT_TIMEOUT_US) {
+      usleep(1000);
+    }
+    ASSERT_EQ(count, handler_.get_flushed_count());
+  }
+protected:
+  ObSqlNio nio_;
+  TestSqlSockHandler handler_;
+  int client_fd_;
+};
+
+TEST_F(TestSqlNio, write_directly)
+{
+  // fits in the socket buffer, written and flushed by the calling worker thread
+  const int64_t sz = 1024;
+  char buf[sz];
+  fill(buf, sz);
+  nio_.async_write_data(handler_.get_sess(), buf, sz);
+  ASSERT_EQ(1, handler_.get_flushed_count());
+  read_and_check(sz);
+}
+
+TEST_F(TestSqlNio, short_write_resumed_by_io_thread)
+{
+  // much larger than both socket buffers and the client is not reading yet:
+  // the worker thread writes what fits, hits EAGAIN and hands the rest over
+  const int64_t sz = 16L * 1024 * 1024;
+  char* buf = static_cast<char*>(ob_malloc(sz, "SqlNioTest"));
+  ASSERT_TRUE(NULL != buf);
+  fill(buf, sz);
+  nio_.async_write_data(handler_.get_sess(), buf, sz);
+  ASSERT_EQ(0, handler_.get_flushed_count());
+  // let the epoll thread find the socket buffer still full and wait for EPOLLOUT
+  usleep(100 * 1000);
+  ASSERT_EQ(0, handler_.get_flushed_count());
+  ASSERT_FALSE(nio_.has_error(handler_.get_sess()));
+
+  // draining the socket resumes the write, every byte arrives once and in order
+  read_and_check(sz);
+  wait_flushed(1);
+  ASSERT_FALSE(nio_.has_error(handler_.get_sess()));
+
+  // the socket is clean again, the next response goes out directly
+  const int64_t small_sz = 100;
+  nio_.async_write_data(handler_.get_sess(), buf, small_sz);
+  ASSERT_EQ(2, handler_.get_flushed_count());
+  read_and_check(small_sz);
+  ob_free(buf);
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
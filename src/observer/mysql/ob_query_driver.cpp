@@ -138,6 +138,8 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       LOG_WARN("fields is null", K(ret), KP(fields));
     }
   }
+  // cast params only depend on session variables, which can not change during the response
+  const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
   while (OB_SUCC(ret) && row_num < limit_count && !OB_FAIL(result.get_next_row(result_row)) ) {
     ObNewRow *row = const_cast<ObNewRow*>(result_row);
     if (is_prexecute_ && row_num == limit_count - 1) {
@@ -183,7 +185,6 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       }
     }
     if (OB_SUCC(ret)) {
-      const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
       ObSMRow sm(protocol_type, *row, dtc_params,
                          result.get_field_columns(),
                          ctx_.schema_guard_,
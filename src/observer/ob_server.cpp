@@ -95,6 +95,7 @@
 #include "storage/tablelock/ob_table_lock_rpc_client.h"
 #include "share/ash/ob_active_sess_hist_task.h"
 #include "share/ash/ob_active_sess_hist_list.h"
+#include "share/ash/ob_cpu_profiler.h"
 #include "share/ob_server_blacklist.h"
 #include "share/ob_primary_standby_service.h" // ObPrimaryStandbyService
 #include "logservice/palf/election/interface/election.h"
@@ -363,6 +364,8 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
     LOG_ERROR("init backup index cache failed", KR(ret));
   } else if (OB_FAIL(ObActiveSessHistList::get_instance().init())) {
     LOG_ERROR("init ASH failed", KR(ret));
+  } else if (OB_FAIL(ObCpuProfiler::get_instance().init())) {
+    LOG_ERROR("init cpu profiler failed", KR(ret));
   } else if (OB_FAIL(ObServerBlacklist::get_instance().init(self_addr_, net_frame_.get_req_transport()))) {
     LOG_ERROR("init server blacklist failed", KR(ret));
   } else if (OB_FAIL(ObDDLRedoLogWriter::get_instance().init())) {
@@ -399,6 +402,10 @@ void ObServer::destroy()
     ObActiveSessHistTask::get_instance().destroy();
     FLOG_INFO("active session history task destroyed");
 
+    FLOG_INFO("begin to destroy cpu profiler");
+    ObCpuProfiler::get_instance().destroy();
+    FLOG_INFO("cpu profiler destroyed");
+
     FLOG_INFO("begin to destroy backup info");
     ObBackupInfoMgr::get_instance().destroy();
     FLOG_INFO("backup info destroyed");
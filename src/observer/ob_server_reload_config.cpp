@@ -22,6 +22,7 @@
 #include "share/ob_cluster_version.h"
 #include "share/ob_task_define.h"
 #include "share/ob_resource_limit.h"
+#include "share/ash/ob_cpu_profiler.h"
 #include "rootserver/ob_root_service.h"
 #include "observer/ob_server_struct.h"
 #include "observer/ob_server.h"
@@ -158,6 +159,7 @@ int ObServerReloadConfig::operator()()
 
     (void)reload_diagnose_info_config(GCONF.enable_perf_event);
     (void)reload_trace_log_config(GCONF.enable_record_trace_log);
+    share::ObCpuProfiler::get_instance().set_sample_interval(GCONF._cpu_profile_sample_interval);
 
     reload_tenant_freezer_config_();
     reload_tenant_scheduler_config_();
@@ -175,6 +177,7 @@ int ObServerReloadConfig::operator()()
   const int64_t cache_size = GCONF.memory_chunk_cache_size;
   const int cache_cnt = (cache_size > 0 ? cache_size : GMEMCONF.get_server_memory_limit()) / INTACT_ACHUNK_SIZE;
   lib::AChunkMgr::instance().set_max_chunk_cache_cnt(cache_cnt);
+  lib::ObLargePageHelper::set_ctx_param(GCONF._large_page_ctx_list.str());
   if (GCONF.cluster_id.get_value() >= 0) {
     obrpc::ObRpcNetHandler::CLUSTER_ID = GCONF.cluster_id.get_value();
     LOG_INFO("set CLUSTER_ID for rpc", "cluster_id", GCONF.cluster_id.get_value());
@@ -236,6 +236,7 @@ public:
   void set_ttl(int32_t ttl_value) { row_iterator_.set_ttl(ttl_value); }
   // parse the filter string
   int parse_filter_string(common::ObArenaAllocator* allocator);
+  const table::hfilter::Filter *get_hfilter() const { return hfilter_; }
 private:
   const ObTableQuery &query_;
   ObHTableRowIterator row_iterator_;
@@ -15,6 +15,27 @@
 using namespace oceanbase::common;
 using namespace oceanbase::table;
 using namespace oceanbase::table::hfilter;
+
+void RowKeyBound::intersect(const RowKeyBound &other)
+{
+  if (other.has_lower_) {
+    const int cmp = has_lower_ ? lower_.compare(other.lower_) : -1;
+    if (cmp < 0) {
+      set_lower(other.lower_, other.lower_inclusive_);
+    } else if (0 == cmp) {
+      lower_inclusive_ = lower_inclusive_ && other.lower_inclusive_;
+    }
+  }
+  if (other.has_upper_) {
+    const int cmp = has_upper_ ? upper_.compare(other.upper_) : 1;
+    if (cmp > 0) {
+      set_upper(other.upper_, other.upper_inclusive_);
+    } else if (0 == cmp) {
+      upper_inclusive_ = upper_inclusive_ && other.upper_inclusive_;
+    }
+  }
+}
+
 Filter::Filter()
   :is_reversed_(false)
 {
@@ -145,6 +166,32 @@ int BinaryComparator::compare_to(const ObString &b)
   return comparator_value_.compare(b);
 }
 
+int BinaryComparator::get_row_key_bound(CompareOperator op, ObIAllocator &allocator, RowKeyBound &bound) const
+{
+  UNUSED(allocator);
+  switch (op) {
+    case CompareOperator::EQUAL:
+      bound.set_lower(comparator_value_, true);
+      bound.set_upper(comparator_value_, true);
+      break;
+    case CompareOperator::GREATER:
+      bound.set_lower(comparator_value_, false);
+      break;
+    case CompareOperator::GREATER_OR_EQUAL:
+      bound.set_lower(comparator_value_, true);
+      break;
+    case CompareOperator::LESS:
+      bound.set_upper(comparator_value_, false);
+      break;
+    case CompareOperator::LESS_OR_EQUAL:
+      bound.set_upper(comparator_value_, true);
+      break;
+    default:
+      break;
+  }
+  return OB_SUCCESS;
+}
+
 int BinaryPrefixComparator::compare_to(const ObString &b)
 {
   int cmp_ret = 0;
@@ -157,6 +204,73 @@ int BinaryPrefixComparator::compare_to(const ObString &b)
   return cmp_ret;
 }
 
+// smallest key greater than every key starting with prefix, not exist if prefix is all 0xff
+static int prefix_successor(ObIAllocator &allocator, const ObString &prefix, ObString &successor, bool &exist)
+{
+  int ret = OB_SUCCESS;
+  int64_t len = prefix.length();
+  exist = false;
+  while (len > 0 && static_cast<uint8_t>(prefix.ptr()[len - 1]) == UINT8_MAX) {
+    --len;
+  }
+  if (len > 0) {
+    char *buf = static_cast<char*>(allocator.alloc(len));
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc prefix successor", K(ret), K(len));
+    } else {
+      MEMCPY(buf, prefix.ptr(), len);
+      buf[len - 1] = static_cast<char>(static_cast<uint8_t>(buf[len - 1]) + 1);
+      successor.assign_ptr(buf, static_cast<int32_t>(len));
+      exist = true;
+    }
+  }
+  return ret;
+}
+
+int BinaryPrefixComparator::get_row_key_bound(CompareOperator op, ObIAllocator &allocator, RowKeyBound &bound) const
+{
+  int ret = OB_SUCCESS;
+  ObString successor;
+  bool has_successor = false;
+  if (CompareOperator::EQUAL == op
+      || CompareOperator::GREATER == op
+      || CompareOperator::LESS_OR_EQUAL == op) {
+    if (OB_FAIL(prefix_successor(allocator, comparator_value_, successor, has_successor))) {
+      LOG_WARN("failed to get prefix successor", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    switch (op) {
+      case CompareOperator::EQUAL:
+        bound.set_lower(comparator_value_, true);
+        if (has_successor) {
+          bound.set_upper(successor, false);
+        }
+        break;
+      case CompareOperator::GREATER:
+        if (has_successor) {
+          bound.set_lower(successor, true);
+        }
+        break;
+      case CompareOperator::GREATER_OR_EQUAL:
+        bound.set_lower(comparator_value_, true);
+        break;
+      case CompareOperator::LESS:
+        bound.set_upper(comparator_value_, false);
+        break;
+      case CompareOperator::LESS_OR_EQUAL:
+        if (has_successor) {
+          bound.set_upper(successor, false);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return ret;
+}
+
 int RegexStringComparator::compare_to(const ObString &b)
 {
   // @todo
@@ -208,6 +322,15 @@ bool RowFilter::filter_row()
   return filter_out_row_;
 }
 
+int RowFilter::get_row_key_bound(ObIAllocator &allocator, RowKeyBound &bound) const
+{
+  int ret = OB_SUCCESS;
+  if (NULL != comparator_ && OB_FAIL(comparator_->get_row_key_bound(cmp_op_, allocator, bound))) {
+    LOG_WARN("failed to get row key bound", K(ret), "cmp_op", compare_operator_to_string(cmp_op_));
+  }
+  return ret;
+}
+
 ////////////////////////////////////////////////////////////////
 QualifierFilter::~QualifierFilter()
 {}
@@ -432,6 +555,21 @@ bool FilterListAND::filter_row_key(const ObHTableCell &first_row_cell)
   return bret;
 }
 
+int FilterListAND::get_row_key_bound(ObIAllocator &allocator, RowKeyBound &bound) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t N = filters_.count();
+  for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+    RowKeyBound child_bound;
+    if (OB_FAIL(filters_.at(i)->get_row_key_bound(allocator, child_bound))) {
+      LOG_WARN("failed to get row key bound", K(ret), K(i));
+    } else {
+      bound.intersect(child_bound);
+    }
+  }
+  return ret;
+}
+
 bool FilterListAND::filter_row()
 {
   bool bret = false;
@@ -23,6 +23,38 @@ namespace table
 namespace hfilter
 {
 typedef table::ObTableQueryResult RowCells;
+
+/// Range of row keys (K) a filter can possibly let through.
+/// The scan pushes it down into the storage key ranges so rows the filter
+/// would drop anyway are never read; the filter itself is still evaluated.
+struct RowKeyBound
+{
+  RowKeyBound()
+      :lower_(),
+       upper_(),
+       has_lower_(false),
+       has_upper_(false),
+       lower_inclusive_(true),
+       upper_inclusive_(true)
+  {}
+  bool is_unbounded() const { return !has_lower_ && !has_upper_; }
+  void set_lower(const ObString &lower, bool inclusive)
+  { lower_ = lower; has_lower_ = true; lower_inclusive_ = inclusive; }
+  void set_upper(const ObString &upper, bool inclusive)
+  { upper_ = upper; has_upper_ = true; upper_inclusive_ = inclusive; }
+  /// narrow this bound to its intersection with other
+  void intersect(const RowKeyBound &other);
+  TO_STRING_KV(K_(lower), K_(upper), K_(has_lower), K_(has_upper),
+               K_(lower_inclusive), K_(upper_inclusive));
+
+  ObString lower_;
+  ObString upper_;
+  bool has_lower_;
+  bool has_upper_;
+  bool lower_inclusive_;
+  bool upper_inclusive_;
+};
+
 /** Interface Filter
  * Interface for row and column filters directly applied within the regionserver. A filter can expect the following call sequence:
  * + reset() : reset the filter state before filtering a new row.
@@ -67,6 +99,9 @@ public:
 
   /// Primarily used to check for conflicts with scans(such as scans that do not read a full row at a time).
   virtual bool has_filter_row() = 0;
+  /// Row keys outside the bound are surely filtered out, unbounded by default.
+  virtual int get_row_key_bound(common::ObIAllocator &allocator, RowKeyBound &bound) const
+  { UNUSEDx(allocator, bound); return common::OB_SUCCESS; }
 
   void set_reversed(bool reversed) { is_reversed_ = reversed; }
   bool is_reversed() const { return is_reversed_; }
@@ -112,6 +147,9 @@ public:
   {}
   virtual ~Comparable() {}
   virtual int compare_to(const ObString &b) = 0;
+  /// Row keys `op` accepts when comparing against this comparable, unbounded by default.
+  virtual int get_row_key_bound(CompareOperator op, common::ObIAllocator &allocator, RowKeyBound &bound) const
+  { UNUSEDx(op, allocator, bound); return common::OB_SUCCESS; }
   VIRTUAL_TO_STRING_KV("comprable", "Comprable");
 protected:
   ObString comparator_value_;
@@ -127,6 +165,7 @@ public:
   {}
   virtual ~BinaryComparator() {}
   virtual int compare_to(const ObString &b) override;
+  virtual int get_row_key_bound(CompareOperator op, common::ObIAllocator &allocator, RowKeyBound &bound) const override;
   TO_STRING_KV("comparable", "BinaryComparator");
 private:
   // disallow copy
@@ -141,6 +180,7 @@ public:
   {}
   virtual ~BinaryPrefixComparator() {}
   virtual int compare_to(const ObString &b) override;
+  virtual int get_row_key_bound(CompareOperator op, common::ObIAllocator &allocator, RowKeyBound &bound) const override;
   TO_STRING_KV("comparable", "BinaryPrefixComparator");
 private:
   // disallow copy
@@ -210,6 +250,7 @@ public:
   virtual bool filter_row_key(const ObHTableCell &first_row_cell) override;
   virtual int filter_cell(const ObHTableCell &cell, ReturnCode &ret_code) override;
   virtual bool filter_row() override;
+  virtual int get_row_key_bound(common::ObIAllocator &allocator, RowKeyBound &bound) const override;
   TO_STRING_KV("filter", "RowFilter",
                "cmp_op", compare_operator_to_string(cmp_op_),
                "comparator", comparator_);
@@ -295,6 +336,7 @@ public:
   virtual bool filter_row_key(const ObHTableCell &first_row_cell) override;
   virtual int filter_cell(const ObHTableCell &cell, ReturnCode &ret_code) override;
   virtual bool filter_row() override;
+  virtual int get_row_key_bound(common::ObIAllocator &allocator, RowKeyBound &bound) const override;
 private:
   static ReturnCode merge_return_code(ReturnCode rc, ReturnCode local_rc);
   ObSEArray<Filter*, 8> seek_hint_filters_;
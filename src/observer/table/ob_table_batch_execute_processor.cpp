@@ -151,6 +151,9 @@ int ObTableBatchExecuteP::try_process()
   const ObTableBatchOperation &batch_operation = arg_.batch_operation_;
   uint64_t table_id = OB_INVALID_ID;
   bool is_index_supported = true;
+  ObSEArray<ObTabletID, 1> tablet_ids;
+  // op_tablet_ids.at(i) is the tablet of operation i, filled when the client did not route
+  ObSEArray<ObTabletID, ObTableBatchOperation::COMMON_BATCH_SIZE> op_tablet_ids;
   if (batch_operation.count() <= 0) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("no operation in the batch", K(ret));
@@ -161,6 +164,15 @@ int ObTableBatchExecuteP::try_process()
   } else if (OB_UNLIKELY(!is_index_supported)) {
     ret = OB_NOT_SUPPORTED;
     LOG_WARN("index type is not supported by table api", K(ret));
+  } else if (!arg_.tablet_id_.is_valid()
+             && ObTableEntityType::ET_HKV != arg_.entity_type_
+             && OB_FAIL(get_tablet_ids(table_id, tablet_ids, op_tablet_ids))) {
+    LOG_WARN("failed to get tablet ids", K(ret), K(table_id));
+  } else if (tablet_ids.count() > 1) {
+    // the client routed a batch spanning several tablets, split it here
+    stat_event_type_ = batch_operation.is_readonly() ?
+        ObTableProccessType::TABLE_API_BATCH_RETRIVE : ObTableProccessType::TABLE_API_BATCH_HYBRID;
+    ret = multi_tablet_execute(batch_operation.is_readonly(), tablet_ids, op_tablet_ids);
   } else {
     if (batch_operation.is_readonly()) {
       if (batch_operation.is_same_properties_names()) {
@@ -275,6 +287,33 @@ int ObTableBatchExecuteP::get_rowkeys(ObIArray<ObRowkey> &rowkeys)
   return ret;
 }
 
+int ObTableBatchExecuteP::get_tablet_ids(uint64_t table_id,
+                                         ObIArray<ObTabletID> &tablet_ids,
+                                         ObIArray<ObTabletID> &op_tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  ObTabletID tablet_id = arg_.tablet_id_;
+  op_tablet_ids.reuse();
+  if (!tablet_id.is_valid()) {
+    ObSEArray<ObRowkey, 3> rowkeys;
+    if (OB_FAIL(get_rowkeys(rowkeys))) {
+      LOG_WARN("failed to get rowkeys", K(ret));
+    } else if (OB_FAIL(get_tablet_of_each_rowkey(table_id, rowkeys, op_tablet_ids))) {
+      LOG_WARN("failed to get tablet of each rowkey", K(ret), K(rowkeys));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < op_tablet_ids.count(); ++i) {
+      if (OB_FAIL(add_var_to_array_no_dup(tablet_ids, op_tablet_ids.at(i)))) {
+        LOG_WARN("failed to add tablet id", K(ret));
+      }
+    }
+  } else {
+    if (OB_FAIL(tablet_ids.push_back(tablet_id))) {
+      LOG_WARN("failed to push back", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObTableBatchExecuteP::get_tablet_ids(uint64_t table_id, ObIArray<ObTabletID> &tablet_ids)
 {
   int ret = OB_SUCCESS;
@@ -757,3 +796,166 @@ int ObTableBatchExecuteP::htable_mutate_row()
   ret = (OB_SUCCESS == tmp_ret) ? ret : tmp_ret;
   return ret;
 }
+
+int ObTableBatchExecuteP::build_tablet_group(const ObTableBatchOperation &batch_operation,
+                                             const ObTabletID &tablet_id,
+                                             const ObIArray<ObTabletID> &op_tablet_ids,
+                                             ObTableBatchOperation &group_ops,
+                                             ObIArray<int64_t> &op_idxs)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(op_tablet_ids.count() != batch_operation.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("tablet count mismatch operation count", K(ret),
+             K(op_tablet_ids.count()), K(batch_operation.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < op_tablet_ids.count(); ++i) {
+    if (op_tablet_ids.at(i) != tablet_id) {
+      // not in this group
+    } else if (OB_FAIL(group_ops.add(batch_operation.at(i)))) {
+      LOG_WARN("failed to add operation", K(ret), K(i));
+    } else if (OB_FAIL(op_idxs.push_back(i))) {
+      LOG_WARN("failed to push back", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObTableBatchExecuteP::execute_tablet_group(const ObTabletID &tablet_id,
+                                               const ObLSID &ls_id,
+                                               const ObIArray<ObTabletID> &op_tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  ObTableBatchOperation group_ops;
+  ObSEArray<int64_t, ObTableBatchOperation::COMMON_BATCH_SIZE> op_idxs;
+  ObTableBatchOperationResult group_result;
+  group_result.set_entity_factory(&default_entity_factory_);
+  table_service_ctx_.param_tablet_id() = tablet_id;
+  table_service_ctx_.param_ls_id() = ls_id;
+  if (OB_FAIL(build_tablet_group(arg_.batch_operation_, tablet_id, op_tablet_ids,
+                                 group_ops, op_idxs))) {
+    LOG_WARN("failed to build tablet group", K(ret), K(tablet_id));
+  } else if (group_ops.is_readonly() && group_ops.is_same_properties_names()) {
+    ret = table_service_->multi_get(table_service_ctx_, group_ops, group_result);
+  } else {
+    ret = table_service_->batch_execute(table_service_ctx_, group_ops, group_result);
+  }
+  if (OB_FAIL(ret)) {
+    if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+      LOG_WARN("failed to execute tablet group", K(ret), K(tablet_id), K(ls_id));
+    }
+  } else if (OB_UNLIKELY(group_result.count() != op_idxs.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("result count mismatch", K(ret), K(group_result.count()), K(op_idxs.count()));
+  } else {
+    for (int64_t i = 0; i < op_idxs.count(); ++i) {
+      result_.at(op_idxs.at(i)) = group_result.at(i);
+    }
+  }
+  table_service_ctx_.reset_get_ctx();
+  return ret;
+}
+
+int ObTableBatchExecuteP::check_batch_leaders(const ObIArray<ObAddr> &leaders,
+                                              const ObAddr &self_addr)
+{
+  int ret = OB_SUCCESS;
+  bool same_leader = true;
+  for (int64_t i = 1; same_leader && i < leaders.count(); ++i) {
+    same_leader = leaders.at(i) == leaders.at(0);
+  }
+  if (OB_UNLIKELY(leaders.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("no leader of the batch", K(ret));
+  } else if (!same_leader) {
+    // no server leads every tablet, rerouting the whole batch would never succeed
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("tablets of the batch are led by different servers", K(ret), K(leaders));
+    LOG_USER_ERROR(OB_NOT_SUPPORTED, "batch operation on tablets led by different servers");
+  } else if (leaders.at(0) != self_addr) {
+    ret = OB_NOT_MASTER;
+    LOG_WARN("tablets of the batch are led by another server", K(ret), K(leaders.at(0)));
+  }
+  return ret;
+}
+
+// Execute a batch whose rows are spread over several tablets.
+//
+// Operations are grouped by tablet, groups whose log stream is led by this
+// server run in one transaction (which becomes a distributed one when the
+// groups sit on different log streams), results are put back in request order.
+//
+// All tablets must be led by this server, see check_batch_leaders: a batch split
+// across servers would neither be atomic nor read one snapshot.
+int ObTableBatchExecuteP::multi_tablet_execute(bool is_readonly,
+                                               const ObIArray<ObTabletID> &tablet_ids,
+                                               const ObIArray<ObTabletID> &op_tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  const ObTableConsistencyLevel consistency_level = arg_.consistency_level_;
+  const ObTableBatchOperation &batch_operation = arg_.batch_operation_;
+  uint64_t &table_id = table_service_ctx_.param_table_id();
+  table_service_ctx_.init_param(get_timeout_ts(), this, &allocator_,
+                                arg_.returning_affected_rows_,
+                                arg_.entity_type_,
+                                arg_.binlog_row_image_type_,
+                                arg_.returning_affected_entity_,
+                                arg_.returning_rowkey_);
+  // ls_ids.at(i) and leaders.at(i) are the log stream and its leader of tablet_ids.at(i)
+  ObSEArray<ObLSID, 4> ls_ids;
+  ObSEArray<ObAddr, 4> leaders;
+  ObLSID snapshot_ls_id;
+  if (OB_FAIL(get_table_id(arg_.table_name_, arg_.table_id_, table_id))) {
+    LOG_WARN("failed to get table id", K(ret));
+  } else if (OB_UNLIKELY(op_tablet_ids.count() != batch_operation.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tablet count mismatch", K(ret), K(op_tablet_ids.count()), K(batch_operation.count()));
+  } else if (OB_FAIL(result_.prepare_allocate(batch_operation.count()))) {
+    LOG_WARN("failed to prepare result", K(ret), K(batch_operation.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ids.count(); ++i) {
+    const ObTabletID &tablet_id = tablet_ids.at(i);
+    ObLSID ls_id;
+    ObAddr leader;
+    if (OB_FAIL(get_ls_id(tablet_id, ls_id))) {
+      LOG_WARN("failed to get ls id", K(ret), K(tablet_id));
+    } else if (OB_FAIL(location_service_->get_leader(GCONF.cluster_id, MTL_ID(), ls_id,
+                                                     false/*force_renew*/, leader))) {
+      LOG_WARN("failed to get ls leader", K(ret), K(ls_id));
+    } else if (OB_FAIL(ls_ids.push_back(ls_id))) {
+      LOG_WARN("failed to push back", K(ret));
+    } else if (OB_FAIL(leaders.push_back(leader))) {
+      LOG_WARN("failed to push back", K(ret));
+    } else if (1 == ls_ids.count()) {
+      snapshot_ls_id = ls_id;
+    } else if (snapshot_ls_id != ls_id) {
+      // several log streams, take a global snapshot
+      snapshot_ls_id.reset();
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(check_batch_leaders(leaders, gctx_.self_addr()))) {
+    LOG_WARN("tablets of the batch are not all led by this server", K(ret),
+             K(tablet_ids), K(ls_ids), K(leaders));
+  }
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(start_trans(is_readonly, (is_readonly ? sql::stmt::T_SELECT : sql::stmt::T_UPDATE),
+                            consistency_level, table_id, snapshot_ls_id, get_timeout_ts()))) {
+      LOG_WARN("failed to start transaction", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ids.count(); ++i) {
+      if (OB_FAIL(execute_tablet_group(tablet_ids.at(i), ls_ids.at(i), op_tablet_ids))) {
+        if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+          LOG_WARN("failed to execute tablet group", K(ret), K(i));
+        }
+      }
+    }
+    int tmp_ret = ret;
+    if (OB_FAIL(end_trans(OB_SUCCESS != ret, req_, get_timeout_ts()))) {
+      LOG_WARN("failed to end trans");
+    }
+    ret = (OB_SUCCESS == tmp_ret) ? ret : tmp_ret;
+  }
+  LOG_TRACE("[TABLE] execute multi tablet batch", K(ret), K(is_readonly),
+            K(tablet_ids), K(ls_ids));
+  return ret;
+}
@@ -43,6 +43,10 @@ private:
   int check_arg2() const;
   int get_rowkeys(common::ObIArray<common::ObRowkey> &rowkeys);
   int get_tablet_ids(uint64_t table_id, ObIArray<ObTabletID> &tablet_ids);
+  // also returns the tablet of each operation in op_tablet_ids if the client did not route
+  int get_tablet_ids(uint64_t table_id,
+                     ObIArray<ObTabletID> &tablet_ids,
+                     ObIArray<ObTabletID> &op_tablet_ids);
   int multi_insert_or_update();
   int multi_get();
   int multi_delete();
@@ -53,6 +57,23 @@ private:
   int htable_delete();
   int htable_put();
   int htable_mutate_row();
+  // batch whose rows span several tablets (and possibly log streams)
+  int multi_tablet_execute(bool is_readonly,
+                           const common::ObIArray<common::ObTabletID> &tablet_ids,
+                           const common::ObIArray<common::ObTabletID> &op_tablet_ids);
+  // OB_NOT_MASTER if one remote server leads every tablet, so the client can reroute,
+  // OB_NOT_SUPPORTED if the tablets are led by different servers
+  static int check_batch_leaders(const common::ObIArray<common::ObAddr> &leaders,
+                                 const common::ObAddr &self_addr);
+  int execute_tablet_group(const common::ObTabletID &tablet_id,
+                           const share::ObLSID &ls_id,
+                           const common::ObIArray<common::ObTabletID> &op_tablet_ids);
+  // operations of batch_operation on tablet_id in request order, op_idxs are their positions in the batch
+  static int build_tablet_group(const table::ObTableBatchOperation &batch_operation,
+                                const common::ObTabletID &tablet_id,
+                                const common::ObIArray<common::ObTabletID> &op_tablet_ids,
+                                table::ObTableBatchOperation &group_ops,
+                                common::ObIArray<int64_t> &op_idxs);
 private:
   static const int64_t COMMON_COLUMN_NUM = 16;
   table::ObTableEntityFactory<table::ObTableEntity> default_entity_factory_;
@@ -108,7 +108,7 @@ void ObQuerySyncSessionRecycle::query_session_recycle()
 int64_t ObQuerySyncMgr::once_ = 0;
 ObQuerySyncMgr *ObQuerySyncMgr::instance_ = NULL;
 
-ObQuerySyncMgr::ObQuerySyncMgr() : session_id_(0)
+ObQuerySyncMgr::ObQuerySyncMgr() : session_id_(0), prefetch_done_seq_(0)
 {}
 
 ObQuerySyncMgr &ObQuerySyncMgr::get_instance()
@@ -140,6 +140,8 @@ int ObQuerySyncMgr::init()
   int ret = OB_SUCCESS;
   if (OB_FAIL(query_session_map_.create(QUERY_SESSION_MAX_SIZE, ObModIds::TABLE_PROC, ObModIds::TABLE_PROC))) {
     LOG_WARN("fail to create query session map", K(ret));
+  } else if (OB_FAIL(prefetch_cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    LOG_WARN("fail to init prefetch cond", K(ret));
   } else if (OB_FAIL(timer_.init())) {
     LOG_WARN("fail to init timer_", K(ret));
   } else if (OB_FAIL(timer_.schedule(query_session_recycle_, QUERY_SESSION_CLEAN_DELAY, true))) {
@@ -158,25 +160,60 @@ uint64_t ObQuerySyncMgr::generate_query_sessid()
 int ObQuerySyncMgr::get_query_session(uint64_t sessid, ObTableQuerySyncSession *&query_session)
 {
   int ret = OB_SUCCESS;
-  get_locker(sessid).lock();
-  if (OB_FAIL(query_session_map_.get_refactored(sessid, query_session))) {
-    if (OB_HASH_NOT_EXIST != ret) {
+  bool need_wait = false;
+  do {
+    need_wait = false;
+    // read before checking the session, a prefetch finished after the check bumps it
+    const int64_t prefetch_done_seq = ATOMIC_LOAD(&prefetch_done_seq_);
+    get_locker(sessid).lock();
+    if (OB_FAIL(query_session_map_.get_refactored(sessid, query_session))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("failed to get session from query session map", K(ret));
+      }
+    } else if (OB_ISNULL(query_session)) {
       ret = OB_ERR_UNEXPECTED;
-      LOG_WARN("failed to get session from query session map", K(ret));
+      LOG_WARN("Unexpected null query session", K(ret), K(sessid));
+    } else if (query_session->is_in_use()) { // one session cannot be held concurrently
+      if (query_session->is_prefetching() && !THIS_WORKER.is_timeout()) {
+        // the previous request is still scanning the batch for this one
+        need_wait = true;
+      } else {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("query session already in use", K(sessid));
+      }
+    } else {
+      query_session->set_in_use(true);
     }
-  } else if (OB_ISNULL(query_session)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("Unexpected null query session", K(ret), K(sessid));
-  } else if (query_session->is_in_use()) { // one session cannot be held concurrently
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("query session already in use", K(sessid));
-  } else {
-    query_session->set_in_use(true);
-  }
-  get_locker(sessid).unlock();
+    get_locker(sessid).unlock();
+    if (need_wait) {
+      wait_prefetch_done(prefetch_done_seq);
+    }
+  } while (need_wait);
   return ret;
 }
 
+void ObQuerySyncMgr::wait_prefetch_done(const int64_t prefetch_done_seq)
+{
+  ObThreadCondGuard guard(prefetch_cond_);
+  while (prefetch_done_seq == ATOMIC_LOAD(&prefetch_done_seq_) && !THIS_WORKER.is_timeout()) {
+    int64_t wait_us = THIS_WORKER.get_timeout_remain();
+    if (wait_us > PREFETCH_WAIT_TIMEOUT_US) {
+      wait_us = PREFETCH_WAIT_TIMEOUT_US;
+    }
+    if (wait_us > 0) {
+      (void)prefetch_cond_.wait_us(wait_us);
+    }
+  }
+}
+
+void ObQuerySyncMgr::notify_prefetch_done()
+{
+  ObThreadCondGuard guard(prefetch_cond_);
+  ATOMIC_INC(&prefetch_done_seq_);
+  (void)prefetch_cond_.broadcast();
+}
+
 int ObQuerySyncMgr::set_query_session(uint64_t sessid, ObTableQuerySyncSession *query_session)
 {
   int ret = OB_SUCCESS;
@@ -299,7 +336,9 @@ ObTableQuerySyncP::ObTableQuerySyncP(const ObGlobalContext &gctx)
       result_row_count_(0),
       query_session_id_(0),
       allocator_(ObModIds::TABLE_PROC),
-      query_session_(nullptr)
+      query_session_(nullptr),
+      timeout_ts_(0),
+      prefetch_session_(nullptr)
 {}
 
 int ObTableQuerySyncP::deserialize()
@@ -443,6 +482,10 @@ int ObTableQuerySyncP::query_scan_with_old_context(const int64_t timeout)
   if (OB_ISNULL(result_iterator)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("query result iterator null", K(ret));
+  } else if (query_session_->has_prefetched()) {
+    if (OB_FAIL(fetch_prefetched_result())) {
+      LOG_WARN("fail to fetch prefetched result", K(ret));
+    }
   } else {
     ObTableQueryResult *query_result = nullptr;
     result_iterator->set_one_result(&result_);  // set result_ as container
@@ -463,6 +506,62 @@ int ObTableQuerySyncP::query_scan_with_old_context(const int64_t timeout)
   return ret;
 }
 
+int ObTableQuerySyncP::fetch_prefetched_result()
+{
+  int ret = query_session_->get_prefetch_ret();
+  ObTableQueryResult &prefetch_result = query_session_->get_prefetch_result();
+  if (OB_FAIL(ret)) {
+    LOG_WARN("prefetch failed", K(ret));
+  } else if (OB_FAIL(result_.add_all_property(prefetch_result))) {
+    LOG_WARN("fail to add prefetched property", K(ret));
+  } else if (OB_FAIL(result_.add_all_row(prefetch_result))) {
+    LOG_WARN("fail to add prefetched rows", K(ret));
+  } else {
+    result_.is_end_ = query_session_->prefetch_is_end();
+  }
+  query_session_->reset_prefetch();
+  return ret;
+}
+
+// Runs after the response of this round is sent, so scanning the next batch
+// overlaps with the network round trip and the client consuming this one.
+void ObTableQuerySyncP::prefetch_next_result(ObTableQuerySyncSession &query_session)
+{
+  int ret = OB_SUCCESS;
+  ObTableQueryResultIterator *result_iterator = query_session.get_result_iterator();
+  ObTableQueryResult &prefetch_result = query_session.get_prefetch_result();
+  ObTableQueryResult *query_result = nullptr;
+  query_session.reset_prefetch();
+  if (OB_ISNULL(result_iterator) || ObTimeUtility::current_time() > timeout_ts_) {
+    // leave it to the next request
+  } else if (FALSE_IT(result_iterator->set_one_result(&prefetch_result))) {
+  } else if (OB_FAIL(result_iterator->get_next_result(query_result))) {
+    if (OB_ITER_END == ret) {
+      query_session.set_prefetched(OB_SUCCESS, true);
+    } else {
+      // report it to the next request, which would have run into it anyway
+      LOG_WARN("fail to prefetch next result", K(ret), K_(query_session_id));
+      query_session.set_prefetched(ret, true);
+    }
+  } else {
+    query_session.set_prefetched(OB_SUCCESS, !result_iterator->has_more_result());
+  }
+}
+
+int ObTableQuerySyncP::after_process(int error_code)
+{
+  // finish the audit of this round first, the prefetch below is not part of it
+  int ret = ParentType::after_process(error_code);
+  if (OB_NOT_NULL(prefetch_session_)) {
+    prefetch_next_result(*prefetch_session_);
+    prefetch_session_->set_prefetching(false);
+    prefetch_session_->set_in_use(false);
+    prefetch_session_ = nullptr;
+    ObQuerySyncMgr::get_instance().notify_prefetch_done();
+  }
+  return ret;
+}
+
 int ObTableQuerySyncP::query_scan_with_new_context(
     ObTableQuerySyncSession *query_session, table::ObTableQueryResultIterator *result_iterator, const int64_t timeout)
 {
@@ -599,6 +698,10 @@ int ObTableQuerySyncP::try_process()
       if (OB_FAIL(destory_query_session(false))) {
         LOG_WARN("fail to destory query session", K(ret), K(query_session_id_));
       }
+    } else if (GCONF._enable_tableapi_query_prefetch) {
+      // keep the session in use, it is released after prefetching
+      query_session_->set_prefetching(true);
+      prefetch_session_ = query_session_;
     } else {
       query_session_->set_in_use(false);
     }
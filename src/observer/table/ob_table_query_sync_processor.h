@@ -12,6 +12,7 @@
 
 #ifndef _OB_TABLE_QUERY_SYNC_PROCESSOR_H
 #define _OB_TABLE_QUERY_SYNC_PROCESSOR_H 1
+#include "lib/lock/ob_thread_cond.h"
 #include "rpc/obrpc/ob_rpc_proxy.h"
 #include "rpc/obrpc/ob_rpc_processor.h"
 #include "share/table/ob_table_rpc_proxy.h"
@@ -44,7 +45,12 @@ public:
       result_iterator_(nullptr),
       allocator_(ObModIds::TABLE_PROC),
       table_service_ctx_(allocator_),
-      iterator_mementity_(nullptr)
+      iterator_mementity_(nullptr),
+      prefetch_result_(),
+      is_prefetching_(false),
+      has_prefetched_(false),
+      prefetch_is_end_(false),
+      prefetch_ret_(common::OB_SUCCESS)
   {}
   ~ObTableQuerySyncSession();
 
@@ -60,6 +66,29 @@ public:
   ObArenaAllocator *get_allocator() {return &allocator_;}
   common::ObObjectID get_tenant_id() { return tenant_id_; }
 
+public:
+  // the batch after the one just responded is scanned ahead while the client
+  // consumes the current one, see ObTableQuerySyncP::after_process
+  table::ObTableQueryResult &get_prefetch_result() { return prefetch_result_; }
+  void set_prefetching(bool prefetching) { ATOMIC_STORE(&is_prefetching_, prefetching); }
+  bool is_prefetching() const { return ATOMIC_LOAD(&is_prefetching_); }
+  void set_prefetched(int prefetch_ret, bool is_end)
+  {
+    prefetch_ret_ = prefetch_ret;
+    prefetch_is_end_ = is_end;
+    has_prefetched_ = true;
+  }
+  bool has_prefetched() const { return has_prefetched_; }
+  bool prefetch_is_end() const { return prefetch_is_end_; }
+  int get_prefetch_ret() const { return prefetch_ret_; }
+  void reset_prefetch()
+  {
+    prefetch_result_.reset();
+    has_prefetched_ = false;
+    prefetch_is_end_ = false;
+    prefetch_ret_ = common::OB_SUCCESS;
+  }
+
 public:
   sql::TransState* get_trans_state() {return &trans_state_;}
   transaction::ObTxDesc* get_trans_desc() {return trans_desc_;}
@@ -74,6 +103,11 @@ private:
   ObArenaAllocator allocator_;
   ObTableServiceQueryCtx table_service_ctx_;
   lib::MemoryContext iterator_mementity_;
+  table::ObTableQueryResult prefetch_result_;
+  bool is_prefetching_;
+  bool has_prefetched_;
+  bool prefetch_is_end_;
+  int prefetch_ret_;
 
 private:
   // txn control
@@ -121,6 +155,8 @@ public:
   int get_query_session(uint64_t sessid, ObTableQuerySyncSession *&query_sess_ctx);
   int set_query_session(uint64_t sessid, ObTableQuerySyncSession *query_sess_ctx);
   void clean_timeout_query_session();
+  // wake up requests waiting for the prefetch of their session
+  void notify_prefetch_done();
 
 public:
   ObQueryHashMap *get_query_session_map();
@@ -131,6 +167,8 @@ public:
 private:
   int init();
   int rollback_trans(ObTableQuerySyncSession &query_session);
+  // wait until some prefetch finishes after prefetch_done_seq was read, or the request times out
+  void wait_prefetch_done(const int64_t prefetch_done_seq);
   ObQuerySyncMgr();
   DISALLOW_COPY_AND_ASSIGN(ObQuerySyncMgr);
 
@@ -139,6 +177,7 @@ private:
   static const uint64_t DEFAULT_LOCK_ARR_SIZE = 2000;
   static const uint64_t QUERY_SESSION_MAX_SIZE = 1000;
   static const uint64_t QUERY_SESSION_CLEAN_DELAY = 180 * 1000 * 1000; // 180s
+  static const int64_t PREFETCH_WAIT_TIMEOUT_US = 10 * 1000; // 10ms
 
 private:
   static int64_t once_;  // for creating singleton instance
@@ -148,6 +187,9 @@ private:
   lib::ObMutex locker_arr_[DEFAULT_LOCK_ARR_SIZE];
   ObQuerySyncSessionRecycle query_session_recycle_;
   common::ObTimer timer_;
+  // bumped whenever a prefetch finishes, waiters are woken up by prefetch_cond_
+  int64_t prefetch_done_seq_;
+  common::ObThreadCond prefetch_cond_;
 };
 
 /**
@@ -170,6 +212,7 @@ protected:
   virtual void audit_on_finish() override;
   virtual uint64_t get_request_checksum() override;
   virtual table::ObTableAPITransCb *new_callback(rpc::ObRequest *req) override;
+  virtual int after_process(int error_code) override;
 
 private:
   int process_query_start();
@@ -187,6 +230,8 @@ private:
   int query_scan_with_old_context(const int64_t timeout);
   int query_scan_with_new_context(ObTableQuerySyncSession * session_ctx, table::ObTableQueryResultIterator *result_iterator,
     const int64_t timeout);
+  int fetch_prefetched_result();
+  void prefetch_next_result(ObTableQuerySyncSession &query_session);
 
 private:
   void set_trans_from_session(ObTableQuerySyncSession *query_session);
@@ -199,6 +244,8 @@ private:
   ObArenaAllocator allocator_;
   ObTableQuerySyncSession *query_session_;
   int64_t timeout_ts_;
+  // session whose next batch is prefetched after the response is sent
+  ObTableQuerySyncSession *prefetch_session_;
 };
 
 } // end namespace observer
@@ -395,6 +395,38 @@ int ObTableApiProcessorBase::get_tablet_by_rowkey(uint64_t table_id, const ObIAr
   return ret;
 }
 
+int ObTableApiProcessorBase::get_tablet_of_each_rowkey(uint64_t table_id, const ObIArray<ObRowkey> &rowkeys,
+                                                       ObIArray<ObTabletID> &tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  share::schema::ObSchemaGetterGuard schema_guard;
+  const uint64_t tenant_id = MTL_ID();
+  const ObTableSchema *table_schema = NULL;
+  tablet_ids.reuse();
+  if (OB_FAIL(gctx_.schema_service_->get_tenant_schema_guard(tenant_id, schema_guard))) {
+    LOG_WARN("failed to get schema guard", K(ret), K(tenant_id));
+  } else if (OB_FAIL(schema_guard.get_table_schema(tenant_id, table_id, table_schema))) {
+    LOG_WARN("failed to get table schema", K(ret), K(tenant_id), K(table_id));
+  } else if (OB_ISNULL(table_schema)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("table schema is null", K(ret), K(table_id));
+  } else if (!table_schema->is_partitioned_table()) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < rowkeys.count(); ++i) {
+      if (OB_FAIL(tablet_ids.push_back(table_schema->get_tablet_id()))) {
+        LOG_WARN("failed to push back", K(ret));
+      }
+    }
+  } else {
+    SMART_VAR(sql::ObTableLocation, location_calc) {
+      if (OB_FAIL(location_calc.calculate_tablet_id_of_each_rowkey(
+                      session(), schema_guard, table_id, rowkeys, tablet_ids))) {
+        LOG_WARN("failed to calc tablet of each rowkey", K(ret), K(table_id));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTableApiProcessorBase::setup_tx_snapshot_(transaction::ObTxDesc &trans_desc,
                                                 const bool strong_read,
                                                 const share::ObLSID &ls_id,
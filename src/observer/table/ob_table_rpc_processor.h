@@ -136,6 +136,9 @@ public:
   inline transaction::ObTxDesc *get_trans_desc() { return trans_desc_; }
   int get_tablet_by_rowkey(uint64_t table_id, const ObIArray<ObRowkey> &rowkeys,
                            ObIArray<ObTabletID> &tablet_ids);
+  // unlike get_tablet_by_rowkey, tablet_ids.at(i) is the tablet of rowkeys.at(i)
+  int get_tablet_of_each_rowkey(uint64_t table_id, const ObIArray<ObRowkey> &rowkeys,
+                                ObIArray<ObTabletID> &tablet_ids);
   inline transaction::ObTxReadSnapshot &get_tx_snapshot() { return tx_snapshot_; }
   int get_table_id(const ObString &table_name, const uint64_t arg_table_id, uint64_t &real_table_id) const;
 protected:
@@ -2001,6 +2001,82 @@ int ObTableService::fill_query_scan_ranges(ObTableServiceCtx &ctx,
   return ret;
 }
 
+// The row key bound implied by the hbase filter is intersected with every scan
+// range, so the storage layer never reads rows the filter is sure to drop.
+// Ranges left empty are removed; the filter is still applied to what remains.
+int ObTableService::pushdown_htable_filter(ObTableServiceCtx &ctx,
+                                           const table::hfilter::Filter &hfilter,
+                                           storage::ObTableScanParam &scan_param)
+{
+  int ret = OB_SUCCESS;
+  table::hfilter::RowKeyBound bound;
+  const int64_t rowkey_cnt = ctx.columns_type_.count();
+  common::ObArenaAllocator *allocator = ctx.param_.allocator_;
+  ObObj *lower_objs = NULL;
+  ObObj *upper_objs = NULL;
+  if (OB_ISNULL(allocator)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("allocator is null", K(ret));
+  } else if (OB_FAIL(hfilter.get_row_key_bound(*allocator, bound))) {
+    LOG_WARN("failed to get row key bound", K(ret));
+  } else if (bound.is_unbounded() || rowkey_cnt <= 0) {
+    // nothing to push down
+  } else if (OB_ISNULL(lower_objs = static_cast<ObObj*>(allocator->alloc(sizeof(ObObj) * rowkey_cnt)))
+             || OB_ISNULL(upper_objs = static_cast<ObObj*>(allocator->alloc(sizeof(ObObj) * rowkey_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("no memory", K(ret), K(rowkey_cnt));
+  } else {
+    // rowkey of a htable is (K, Q, T), pad Q and T so the bound covers every cell of the row
+    lower_objs[0].set_varbinary(bound.lower_);
+    upper_objs[0].set_varbinary(bound.upper_);
+    for (int64_t i = 1; i < rowkey_cnt; ++i) {
+      lower_objs[i] = bound.lower_inclusive_ ? ObObj::make_min_obj() : ObObj::make_max_obj();
+      upper_objs[i] = bound.upper_inclusive_ ? ObObj::make_max_obj() : ObObj::make_min_obj();
+    }
+    const ObRowkey lower_key(lower_objs, rowkey_cnt);
+    const ObRowkey upper_key(upper_objs, rowkey_cnt);
+    ObSEArray<ObNewRange, 4> narrowed_ranges;
+    const int64_t N = scan_param.key_ranges_.count();
+    for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+      ObNewRange range = scan_param.key_ranges_.at(i);
+      if (bound.has_lower_ && lower_key.compare(range.start_key_) > 0) {
+        range.start_key_ = lower_key;
+        range.border_flag_.unset_min_value();
+        if (bound.lower_inclusive_) {
+          range.border_flag_.set_inclusive_start();
+        } else {
+          range.border_flag_.unset_inclusive_start();
+        }
+      }
+      if (bound.has_upper_ && upper_key.compare(range.end_key_) < 0) {
+        range.end_key_ = upper_key;
+        range.border_flag_.unset_max_value();
+        if (bound.upper_inclusive_) {
+          range.border_flag_.set_inclusive_end();
+        } else {
+          range.border_flag_.unset_inclusive_end();
+        }
+      }
+      const int cmp = range.start_key_.compare(range.end_key_);
+      if (cmp > 0 || (0 == cmp && !(range.border_flag_.inclusive_start() && range.border_flag_.inclusive_end()))) {
+        // the filter drops every row of this range
+      } else if (OB_FAIL(narrowed_ranges.push_back(range))) {
+        LOG_WARN("fail to push back key range", K(ret), K(range));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (narrowed_ranges.empty()) {
+      // keep the original ranges, the filter will drop their rows
+      LOG_DEBUG("htable filter excludes all scan ranges", K(bound));
+    } else if (OB_FAIL(scan_param.key_ranges_.assign(narrowed_ranges))) {
+      LOG_WARN("fail to assign key ranges", K(ret));
+    } else {
+      LOG_DEBUG("push down htable filter", K(bound), "key_ranges", scan_param.key_ranges_);
+    }
+  }
+  return ret;
+}
+
 int ObTableService::fill_query_scan_param(ObTableServiceCtx &ctx,
                                           const ObIArray<uint64_t> &output_column_ids,
                                           int64_t schema_version,
@@ -2267,6 +2343,11 @@ int ObTableService::execute_query(ObTableServiceQueryCtx &ctx, const ObTableQuer
                                             (table_id != index_id) ? padding_num : -1,
                                             ctx.scan_param_))) {
     LOG_WARN("failed to fill range", K(ret));
+  } else if (NULL != p_hcolumn_desc && table_id == index_id
+             && NULL != ctx.htable_result_iterator_->get_hfilter()
+             && OB_FAIL(pushdown_htable_filter(ctx, *ctx.htable_result_iterator_->get_hfilter(),
+                                               ctx.scan_param_))) {
+    LOG_WARN("failed to push down htable filter", K(ret));
   } else if (OB_FAIL(fill_query_scan_param(ctx, output_column_ids, schema_version,
                                            query.get_scan_order(), index_id, query.get_limit(),
                                            query.get_offset(), ctx.scan_param_, for_update))) {
@@ -24,6 +24,10 @@ namespace table
 {
 class ObHTableFilterOperator;
 class ObHColumnDescriptor;
+namespace hfilter
+{
+class Filter;
+} // end namespace hfilter
 } // end namespace table
 
 namespace storage		
@@ -311,6 +315,9 @@ private:
                              const ObTableQuery &query,
                              int64_t padding_num,
                              storage::ObTableScanParam &scan_param);
+  int pushdown_htable_filter(ObTableServiceCtx &ctx,
+                             const table::hfilter::Filter &hfilter,
+                             storage::ObTableScanParam &scan_param);
   int fill_query_scan_param(ObTableServiceCtx &ctx,
                             const common::ObIArray<uint64_t> &output_column_ids,
                             int64_t schema_version,
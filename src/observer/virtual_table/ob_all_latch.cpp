@@ -197,6 +197,19 @@ int ObAllLatch::inner_get_next_row(ObNewRow *&row)
             cells[cell_idx].set_int(latch_stat.wait_time_);
             break;
           }
+        case WAIT_TIME_HISTOGRAM: {
+            char *buf = NULL;
+            if (OB_ISNULL(buf = static_cast<char *>(allocator_->alloc(OB_MAX_CHAR_LENGTH)))) {
+              ret = OB_ALLOCATE_MEMORY_FAILED;
+              SERVER_LOG(WARN, "Fail to alloc buf", K(ret));
+            } else {
+              const int64_t len = latch_stat.print_wait_time_hist(buf, OB_MAX_CHAR_LENGTH);
+              cells[cell_idx].set_varchar(ObString(static_cast<int32_t>(len), buf));
+              cells[cell_idx].set_collation_type(
+                  ObCharset::get_default_collation(ObCharset::get_default_charset()));
+            }
+            break;
+          }
         default: {
             ret = OB_ERR_UNEXPECTED;
             SERVER_LOG(WARN, "invalid column id", K(cell_idx), K_(output_column_ids), K(ret));
@@ -55,7 +55,8 @@ private:
     IMMEDIATE_GETS,
     IMMEDIATE_MISSES,
     SPIN_GETS,
-    WAIT_TIME
+    WAIT_TIME,
+    WAIT_TIME_HISTOGRAM
   };
   common::ObAddr *addr_;
   int32_t iter_;
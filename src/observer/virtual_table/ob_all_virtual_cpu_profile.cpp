@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SERVER
+#include "ob_all_virtual_cpu_profile.h"
+
+using namespace oceanbase::observer;
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+ObAllVirtualCpuProfile::ObAllVirtualCpuProfile() :
+    ObVirtualTableScannerIterator(),
+    addr_(),
+    ipstr_(),
+    port_(0),
+    read_pos_(0),
+    end_pos_(0),
+    sample_(),
+    is_first_get_(true)
+{
+  server_ip_[0] = '\0';
+  stack_buf_[0] = '\0';
+}
+
+ObAllVirtualCpuProfile::~ObAllVirtualCpuProfile()
+{
+  reset();
+}
+
+void ObAllVirtualCpuProfile::reset()
+{
+  ObVirtualTableScannerIterator::reset();
+  port_ = 0;
+  ipstr_.reset();
+  read_pos_ = 0;
+  end_pos_ = 0;
+  is_first_get_ = true;
+}
+
+int ObAllVirtualCpuProfile::inner_open()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(set_ip(addr_))) {
+    SERVER_LOG(WARN, "failed to set server ip addr", K(ret));
+  }
+  return ret;
+}
+
+int ObAllVirtualCpuProfile::set_ip(const common::ObAddr &addr)
+{
+  int ret = OB_SUCCESS;
+  MEMSET(server_ip_, 0, sizeof(server_ip_));
+  if (!addr.is_valid()){
+    ret = OB_ERR_UNEXPECTED;
+  } else if (!addr.ip_to_string(server_ip_, sizeof(server_ip_))) {
+    SERVER_LOG(ERROR, "ip to string failed");
+    ret = OB_ERR_UNEXPECTED;
+  } else {
+    ipstr_ = ObString::make_string(server_ip_);
+    port_ = addr.get_port();
+  }
+  return ret;
+}
+
+int ObAllVirtualCpuProfile::inner_get_next_row(common::ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  ObCpuProfiler &profiler = ObCpuProfiler::get_instance();
+  if (is_first_get_) {
+    is_first_get_ = false;
+    read_pos_ = profiler.write_pos() - 1;
+    end_pos_ = std::max(0L, profiler.write_pos() - profiler.size());
+  }
+
+  do {
+    if (read_pos_ < end_pos_) {
+      ret = OB_ITER_END;
+    } else if (profiler.get(read_pos_--, sample_)) {
+      if (OB_FAIL(convert_sample_to_row(sample_, row))) {
+        LOG_WARN("fail convert row", K(ret));
+      }
+      break;
+    } else {
+      // overwritten by the profiler or still being written, skip it
+    }
+  } while (OB_SUCC(ret));
+
+  return ret;
+}
+
+int ObAllVirtualCpuProfile::convert_sample_to_row(const ObCpuProfileSample &sample, ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  ObObj *cells = cur_row_.cells_;
+  if (OB_ISNULL(cells)) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(WARN, "cur row cell is NULL", K(ret));
+  }
+  for (int64_t cell_idx = 0;
+       OB_SUCC(ret) && cell_idx < output_column_ids_.count();
+       ++cell_idx) {
+    const uint64_t column_id = output_column_ids_.at(cell_idx);
+    switch(column_id) {
+      case SVR_IP: {
+        cells[cell_idx].set_varchar(ipstr_);
+        cells[cell_idx].set_collation_type(
+            ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      case SVR_PORT: {
+        cells[cell_idx].set_int(port_);
+        break;
+      }
+      case SAMPLE_ID: {
+        cells[cell_idx].set_int(sample.seq_);
+        break;
+      }
+      case SAMPLE_TIME: {
+        cells[cell_idx].set_timestamp(sample.sample_time_);
+        break;
+      }
+      case TENANT_ID: {
+        cells[cell_idx].set_int(sample.tenant_id_);
+        break;
+      }
+      case SESSION_ID: {
+        cells[cell_idx].set_int(sample.session_id_);
+        break;
+      }
+      case THREAD_ID: {
+        cells[cell_idx].set_int(sample.tid_);
+        break;
+      }
+      case SQL_ID: {
+        cells[cell_idx].set_varchar(sample.sql_id_, static_cast<ObString::obstr_size_t>(STRLEN(sample.sql_id_)));
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      case PLAN_ID: {
+        cells[cell_idx].set_int(sample.plan_id_);
+        break;
+      }
+      case SQL_PLAN_LINE_ID: {
+        if (sample.plan_line_id_ < 0) {
+          cells[cell_idx].set_null();
+        } else {
+          cells[cell_idx].set_int(sample.plan_line_id_);
+        }
+        break;
+      }
+      case EVENT_NO: {
+        cells[cell_idx].set_int(sample.event_no_);
+        break;
+      }
+      case STACK: {
+        // same format as lbt(), leaf frame first
+        int64_t pos = 0;
+        stack_buf_[0] = '\0';
+        for (int64_t i = 0; OB_SUCC(ret) && i < sample.depth_; i++) {
+          if (OB_FAIL(databuff_printf(stack_buf_, STACK_BUF_LEN, pos,
+                                      0 == i ? "0x%lx" : " 0x%lx", sample.frames_[i]))) {
+            if (OB_SIZE_OVERFLOW == ret) {
+              // keep the frames closest to the leaf
+              ret = OB_SUCCESS;
+              break;
+            }
+          }
+        }
+        cells[cell_idx].set_varchar(stack_buf_, static_cast<ObString::obstr_size_t>(STRLEN(stack_buf_)));
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        SERVER_LOG(WARN, "invalid column id", K(column_id), K(cell_idx),
+                   K_(output_column_ids), K(ret));
+        break;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    row = &cur_row_;
+  }
+  return ret;
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_OBSERVER_OB_ALL_VIRTUAL_CPU_PROFILE_H
+#define OCEANBASE_OBSERVER_OB_ALL_VIRTUAL_CPU_PROFILE_H
+#include "share/ob_virtual_table_scanner_iterator.h"
+#include "lib/net/ob_addr.h"
+#include "share/ash/ob_cpu_profiler.h"
+
+namespace oceanbase
+{
+namespace observer
+{
+
+class ObAllVirtualCpuProfile : public common::ObVirtualTableScannerIterator
+{
+public:
+  ObAllVirtualCpuProfile();
+  virtual ~ObAllVirtualCpuProfile();
+  virtual int inner_open() override;
+  virtual int inner_get_next_row(common::ObNewRow *&row) override;
+  virtual void reset();
+  void set_addr(const common::ObAddr &addr) { addr_ = addr; }
+private:
+  int set_ip(const common::ObAddr &addr);
+  int convert_sample_to_row(const share::ObCpuProfileSample &sample, common::ObNewRow *&row);
+private:
+  enum COLUMN_ID
+  {
+    SVR_IP = common::OB_APP_MIN_COLUMN_ID,
+    SVR_PORT,
+    SAMPLE_ID,
+    SAMPLE_TIME,
+    TENANT_ID,
+    SESSION_ID,
+    THREAD_ID,
+    SQL_ID,
+    PLAN_ID,
+    SQL_PLAN_LINE_ID,
+    EVENT_NO,
+    STACK
+  };
+  static const int64_t STACK_BUF_LEN = 1024;
+  DISALLOW_COPY_AND_ASSIGN(ObAllVirtualCpuProfile);
+  common::ObAddr addr_;
+  common::ObString ipstr_;
+  int32_t port_;
+  // samples are read from read_pos_ down to end_pos_, newest first
+  int64_t read_pos_;
+  int64_t end_pos_;
+  share::ObCpuProfileSample sample_;
+  char server_ip_[common::MAX_IP_ADDR_LENGTH + 2];
+  char stack_buf_[STACK_BUF_LEN];
+  bool is_first_get_;
+};
+
+} //namespace observer
+} //namespace oceanbase
+#endif
@@ -43,6 +43,8 @@ void ObFifoArena::ObWriteThrottleInfo::reset()
   ATOMIC_SET(&period_throttled_time_, 0);
   ATOMIC_SET(&total_throttled_count_, 0);
   ATOMIC_SET(&total_throttled_time_, 0);
+  ATOMIC_SET(&predictive_throttled_count_, 0);
+  ATOMIC_SET(&predictive_throttled_time_, 0);
 }
 
 void ObFifoArena::ObWriteThrottleInfo::reset_period_stat_info()
@@ -59,6 +61,36 @@ void ObFifoArena::ObWriteThrottleInfo::record_limit_event(int64_t interval)
   ATOMIC_FAA(&total_throttled_time_, interval);
 }
 
+void ObFifoArena::ObWriteRateModel::reset()
+{
+  ATOMIC_SET(&last_sample_ts_, 0);
+  ATOMIC_SET(&last_allocated_, 0);
+  ATOMIC_SET(&last_reclaimed_, 0);
+  ATOMIC_SET(&alloc_rate_, 0);
+  ATOMIC_SET(&reclaim_rate_, 0);
+}
+
+void ObFifoArena::ObWriteRateModel::update(int64_t cur_ts, int64_t allocated, int64_t reclaimed)
+{
+  int64_t last_ts = ATOMIC_LOAD(&last_sample_ts_);
+  // only the thread which wins the cas takes the sample
+  if (cur_ts - last_ts >= SAMPLE_INTERVAL && ATOMIC_BCAS(&last_sample_ts_, last_ts, cur_ts)) {
+    if (0 != last_ts) {
+      const double elapsed = static_cast<double>(cur_ts - last_ts);
+      const int64_t alloc_sample = static_cast<int64_t>(
+          static_cast<double>(allocated - ATOMIC_LOAD(&last_allocated_)) * 1000000.0 / elapsed);
+      const int64_t reclaim_sample = static_cast<int64_t>(
+          static_cast<double>(reclaimed - ATOMIC_LOAD(&last_reclaimed_)) * 1000000.0 / elapsed);
+      ATOMIC_STORE(&alloc_rate_,
+          (ATOMIC_LOAD(&alloc_rate_) * (100 - EWMA_WEIGHT) + MAX(alloc_sample, 0) * EWMA_WEIGHT) / 100);
+      ATOMIC_STORE(&reclaim_rate_,
+          (ATOMIC_LOAD(&reclaim_rate_) * (100 - EWMA_WEIGHT) + MAX(reclaim_sample, 0) * EWMA_WEIGHT) / 100);
+    }
+    ATOMIC_STORE(&last_allocated_, allocated);
+    ATOMIC_STORE(&last_reclaimed_, reclaimed);
+  }
+}
+
 int ObFifoArena::ObWriteThrottleInfo::check_and_calc_decay_factor(int64_t memstore_threshold,
                                                                   int64_t trigger_percentage,
                                                                   int64_t alloc_duration)
@@ -288,34 +320,60 @@ void ObFifoArena::speed_limit(int64_t cur_mem_hold, int64_t alloc_size)
   if (trigger_percentage < 100) {
     if (OB_UNLIKELY(cur_mem_hold < 0 || alloc_size <= 0 || lastest_memstore_threshold_ <= 0 || trigger_percentage <= 0)) {
       COMMON_LOG(ERROR, "invalid arguments", K(cur_mem_hold), K(alloc_size), K(lastest_memstore_threshold_), K(trigger_percentage));
-    } else if (cur_mem_hold > (trigger_mem_limit = lastest_memstore_threshold_ * trigger_percentage / 100)) {
-      int64_t alloc_duration = get_writing_throttling_maximum_duration_();
-      if (OB_FAIL(throttle_info_.check_and_calc_decay_factor(lastest_memstore_threshold_, trigger_percentage, alloc_duration))) {
-        COMMON_LOG(WARN, "failed to check_and_calc_decay_factor", K(cur_mem_hold), K(alloc_size), K(throttle_info_));
-      } else {
-        int64_t throttling_interval = get_throttling_interval(cur_mem_hold, alloc_size, trigger_mem_limit);
-        int64_t cur_ts = ObTimeUtility::current_time();
-        int64_t new_base_ts = ATOMIC_AAF(&last_base_ts_, throttling_interval);
-        int64_t sleep_interval = new_base_ts - cur_ts;
-        if (sleep_interval > 0) {
-          //The playback of a single log may allocate 2M blocks multiple times
-          uint32_t final_sleep_interval =
-              static_cast<uint32_t>(MIN((get_writing_throttling_sleep_interval() + sleep_interval - 1), MAX_WAIT_INTERVAL));
-          get_writing_throttling_sleep_interval() = final_sleep_interval;
-          throttle_info_.record_limit_event(sleep_interval - 1);
+    } else {
+      int64_t throttling_interval = 0;
+      bool is_predictive = false;
+      trigger_mem_limit = lastest_memstore_threshold_ * trigger_percentage / 100;
+      rate_model_.update(ObTimeUtility::current_time(), ATOMIC_LOAD(&allocated_), ATOMIC_LOAD(&reclaimed_));
+      if (cur_mem_hold > trigger_mem_limit) {
+        int64_t alloc_duration = get_writing_throttling_maximum_duration_();
+        if (OB_FAIL(throttle_info_.check_and_calc_decay_factor(lastest_memstore_threshold_, trigger_percentage, alloc_duration))) {
+          COMMON_LOG(WARN, "failed to check_and_calc_decay_factor", K(cur_mem_hold), K(alloc_size), K(throttle_info_));
         } else {
-          inc_update(&last_base_ts_, ObTimeUtility::current_time());
-          throttle_info_.reset_period_stat_info();
-          last_reclaimed_ = ATOMIC_LOAD(&reclaimed_);
+          throttling_interval = get_throttling_interval(cur_mem_hold, alloc_size, trigger_mem_limit);
         }
+      } else {
+        // below the trigger: slow writers down in proportion to how fast the
+        // memstore is predicted to reach the trigger, so that the cubic throttle
+        // above is rarely reached during sustained ingest
+        int64_t horizon = get_writing_throttling_predictive_horizon_();
+        if (horizon > 0) {
+          throttling_interval = get_predictive_throttling_interval(cur_mem_hold, alloc_size, trigger_mem_limit, horizon);
+          is_predictive = true;
+        }
+      }
+      if (OB_SUCC(ret) && throttling_interval > 0) {
+        do_throttle(throttling_interval, is_predictive);
         if (REACH_TIME_INTERVAL(1 * 1000 * 1000L)) {
           COMMON_LOG(INFO, "report write throttle info", K(alloc_size), K(throttling_interval), K(attr_),
                      "freed memory(MB):" , (ATOMIC_LOAD(&reclaimed_) - last_reclaimed_) / 1024 / 1024,
                      "last_base_ts", ATOMIC_LOAD(&last_base_ts_),
-                     K(cur_mem_hold), K(throttle_info_));
+                     K(cur_mem_hold), K(trigger_mem_limit), K(is_predictive), K(throttle_info_), K(rate_model_));
         }
       }
-    } else {/*do nothing*/}
+    }
+  }
+}
+
+void ObFifoArena::do_throttle(int64_t throttling_interval, bool is_predictive)
+{
+  int64_t cur_ts = ObTimeUtility::current_time();
+  int64_t new_base_ts = ATOMIC_AAF(&last_base_ts_, throttling_interval);
+  int64_t sleep_interval = new_base_ts - cur_ts;
+  if (sleep_interval > 0) {
+    //The playback of a single log may allocate 2M blocks multiple times
+    uint32_t final_sleep_interval =
+        static_cast<uint32_t>(MIN((get_writing_throttling_sleep_interval() + sleep_interval - 1), MAX_WAIT_INTERVAL));
+    get_writing_throttling_sleep_interval() = final_sleep_interval;
+    throttle_info_.record_limit_event(sleep_interval - 1);
+    if (is_predictive) {
+      ATOMIC_INC(&throttle_info_.predictive_throttled_count_);
+      ATOMIC_FAA(&throttle_info_.predictive_throttled_time_, sleep_interval - 1);
+    }
+  } else {
+    inc_update(&last_base_ts_, ObTimeUtility::current_time());
+    throttle_info_.reset_period_stat_info();
+    last_reclaimed_ = ATOMIC_LOAD(&reclaimed_);
   }
 }
 
@@ -335,6 +393,37 @@ int64_t ObFifoArena::get_throttling_interval(int64_t cur_mem_hold,
   return alloc_size * ret_interval / MEM_SLICE_SIZE + MIN_INTERVAL_PER_ALLOC;
 }
 
+// Writers are allowed to consume the remaining headroom below the trigger
+// evenly over the prediction horizon on top of what freeze/flush reclaims:
+//   target_rate = reclaim_rate + (trigger_mem_limit - cur_mem_hold) / horizon
+// The target rate only kicks in when the trigger would be reached within the
+// horizon at the current net allocation rate, and it decreases smoothly towards
+// the reclaim rate as the headroom shrinks. With nothing reclaimed the target
+// rate goes to zero near the trigger, so the interval is capped by
+// MAX_PREDICTIVE_INTERVAL: this path only paces writers, stopping them is left
+// to the throttle above the trigger.
+int64_t ObFifoArena::get_predictive_throttling_interval(int64_t cur_mem_hold,
+                                                        int64_t alloc_size,
+                                                        int64_t trigger_mem_limit,
+                                                        int64_t horizon)
+{
+  int64_t ret_interval = 0;
+  const int64_t alloc_rate = rate_model_.get_alloc_rate();
+  const int64_t reclaim_rate = rate_model_.get_reclaim_rate();
+  const int64_t net_rate = alloc_rate - reclaim_rate;
+  const int64_t headroom = trigger_mem_limit - cur_mem_hold;
+  if (net_rate > 0 && headroom > 0 && horizon > 0) {
+    const double time_to_trigger = static_cast<double>(headroom) * 1000000.0 / static_cast<double>(net_rate);
+    if (time_to_trigger < static_cast<double>(horizon)) {
+      const double target_rate = static_cast<double>(reclaim_rate)
+          + static_cast<double>(headroom) * 1000000.0 / static_cast<double>(horizon);
+      const double interval = static_cast<double>(alloc_size) * 1000000.0 / MAX(target_rate, 1.0);
+      ret_interval = static_cast<int64_t>(MIN(interval, static_cast<double>(MAX_PREDICTIVE_INTERVAL)));
+    }
+  }
+  return ret_interval;
+}
+
 void ObFifoArena::set_memstore_threshold(int64_t memstore_threshold)
 {
   ATOMIC_STORE(&lastest_memstore_threshold_, memstore_threshold);
@@ -378,5 +467,21 @@ int64_t ObFifoArena::get_writing_throttling_maximum_duration_() const
   return duration;
 }
 
+int64_t ObFifoArena::get_writing_throttling_predictive_horizon_() const
+{
+  RLOCAL(INTEGER_WRAPPER<DEFAULT_PREDICTIVE_HORIZON>, wrapper);
+  int64_t &horizon = (&wrapper)->v_;
+  if (TC_REACH_TIME_INTERVAL(5 * 1000 * 1000)) { // 5s
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(attr_.tenant_id_));
+    if (!tenant_config.is_valid()) {
+      //keep default
+      COMMON_LOG(INFO, "failed to get tenant config", K(attr_));
+    } else {
+      horizon = tenant_config->_writing_throttling_predictive_horizon;
+    }
+  }
+  return horizon;
+}
+
 }; // end namespace allocator
 }; // end namespace oceanbase
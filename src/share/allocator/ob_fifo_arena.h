@@ -189,7 +189,9 @@ private:
                  K(period_throttled_count_),
                  K(period_throttled_time_),
                  K(total_throttled_count_),
-                 K(total_throttled_time_));
+                 K(total_throttled_time_),
+                 K(predictive_throttled_count_),
+                 K(predictive_throttled_time_));
   public:
     //control info
     double decay_factor_;
@@ -201,6 +203,31 @@ private:
     int64_t period_throttled_time_;
     int64_t total_throttled_count_;
     int64_t total_throttled_time_;
+    int64_t predictive_throttled_count_;
+    int64_t predictive_throttled_time_;
+  };
+
+  // Tracks the smoothed rate at which memstore memory is allocated by writers
+  // and reclaimed by minor freeze/flush (memtable release), both in bytes per
+  // second. Used to throttle writes before memstore hold reaches the trigger.
+  struct ObWriteRateModel {
+  public:
+    ObWriteRateModel() { reset(); }
+    ~ObWriteRateModel() {}
+    void reset();
+    void update(int64_t cur_ts, int64_t allocated, int64_t reclaimed);
+    int64_t get_alloc_rate() const { return ATOMIC_LOAD(&alloc_rate_); }
+    int64_t get_reclaim_rate() const { return ATOMIC_LOAD(&reclaim_rate_); }
+    TO_STRING_KV(K(alloc_rate_), K(reclaim_rate_), K(last_sample_ts_));
+  public:
+    static const int64_t SAMPLE_INTERVAL = 100 * 1000; // 100ms
+    // weight of the newest sample in percent
+    static const int64_t EWMA_WEIGHT = 20;
+    int64_t last_sample_ts_;
+    int64_t last_allocated_;
+    int64_t last_reclaimed_;
+    int64_t alloc_rate_;
+    int64_t reclaim_rate_;
   };
 private:
   void release_ref(Ref* ref);
@@ -213,15 +240,23 @@ private:
   int64_t get_throttling_interval(int64_t cur_mem_hold,
                                int64_t alloc_size,
                                int64_t trigger_mem_limit);
+  int64_t get_predictive_throttling_interval(int64_t cur_mem_hold,
+                                             int64_t alloc_size,
+                                             int64_t trigger_mem_limit,
+                                             int64_t horizon);
+  void do_throttle(int64_t throttling_interval, bool is_predictive);
   int64_t get_actual_hold_size(Page* page);
   int64_t get_writing_throttling_trigger_percentage_() const;
   int64_t get_writing_throttling_maximum_duration_() const;
+  int64_t get_writing_throttling_predictive_horizon_() const;
 private:
   static const int64_t MAX_WAIT_INTERVAL = 20 * 1000 * 1000;//20s
   static const int64_t MEM_SLICE_SIZE = 2 * 1024 * 1024; //Bytes per usecond
   static const int64_t MIN_INTERVAL = 20000;
   static const int64_t DEFAULT_TRIGGER_PERCENTAGE = 100;
   static const int64_t DEFAULT_DURATION = 60 * 60 * 1000 * 1000L;//us
+  static const int64_t DEFAULT_PREDICTIVE_HORIZON = 0;//us, turned off by default
+  static const int64_t MAX_PREDICTIVE_INTERVAL = 20 * 1000;//us, per allocation
   lib::ObMemAttr attr_;
   ObIAllocator* allocator_;
   int64_t nway_;
@@ -234,6 +269,7 @@ private:
   int64_t last_reclaimed_;
   Page* cur_pages_[MAX_CACHED_PAGE_COUNT];
   ObWriteThrottleInfo throttle_info_;
+  ObWriteRateModel rate_model_;
   int64_t lastest_memstore_threshold_;//Save the latest memstore_threshold
   DISALLOW_COPY_AND_ASSIGN(ObFifoArena);
 };
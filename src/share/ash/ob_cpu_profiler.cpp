@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SHARE
+
+#include <link.h>
+#include <sys/time.h>
+#include "lib/oblog/ob_log.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/ash/ob_active_session_guard.h"
+#include "lib/signal/ob_libunwind.h"
+#include "share/ash/ob_cpu_profiler.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+static int get_load_base(struct dl_phdr_info *info, size_t size, void *data)
+{
+  UNUSED(size);
+  // the first object reported is the main executable
+  *static_cast<uintptr_t *>(data) = info->dlpi_addr;
+  return 1;
+}
+
+ObCpuProfiler &ObCpuProfiler::get_instance()
+{
+  static ObCpuProfiler the_one;
+  return the_one;
+}
+
+ObCpuProfiler::ObCpuProfiler()
+  : is_inited_(false), interval_us_(0), load_base_(0), write_pos_(0), list_()
+{
+}
+
+int ObCpuProfiler::init()
+{
+  int ret = OB_SUCCESS;
+  // 16MB at most
+  const int64_t max_mem_for_profiler = 16 * 1024 * 1024;
+  list_.set_label("cpu_profiler");
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("cpu profiler init twice", K(ret));
+  } else if (OB_FAIL(list_.prepare_allocate(max_mem_for_profiler / sizeof(ObCpuProfileSample)))) {
+    LOG_WARN("fail init cpu profiler circular buffer", K(ret));
+  } else if (OB_FAIL(install_handler())) {
+    LOG_WARN("fail install SIGPROF handler", K(ret));
+  } else {
+    dl_iterate_phdr(get_load_base, &load_base_);
+    is_inited_ = true;
+    apply_interval(ATOMIC_LOAD(&interval_us_));
+    LOG_INFO("init cpu profiler OK", "size", list_.size(), KP_(load_base), K_(interval_us));
+  }
+  return ret;
+}
+
+void ObCpuProfiler::destroy()
+{
+  if (is_inited_) {
+    apply_interval(0);
+    is_inited_ = false;
+  }
+}
+
+int ObCpuProfiler::install_handler()
+{
+  int ret = OB_SUCCESS;
+  struct sigaction sa;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART | SA_ONSTACK;
+  sa.sa_sigaction = sigprof_handler;
+  sigemptyset(&sa.sa_mask);
+  if (-1 == sigaction(SIGPROF, &sa, nullptr)) {
+    ret = OB_INIT_FAIL;
+    LOG_WARN("sigaction failed", K(ret), K(errno));
+  }
+  return ret;
+}
+
+void ObCpuProfiler::set_sample_interval(const int64_t interval_us)
+{
+  if (interval_us != ATOMIC_LOAD(&interval_us_)) {
+    ATOMIC_STORE(&interval_us_, interval_us);
+    if (is_inited_) {
+      apply_interval(interval_us);
+    }
+    LOG_INFO("set cpu profile sample interval", K(interval_us));
+  }
+}
+
+void ObCpuProfiler::apply_interval(const int64_t interval_us)
+{
+  struct itimerval timer;
+  timer.it_interval.tv_sec = interval_us / 1000000;
+  timer.it_interval.tv_usec = interval_us % 1000000;
+  timer.it_value = timer.it_interval;
+  if (0 != setitimer(ITIMER_PROF, &timer, nullptr)) {
+    LOG_WARN("setitimer failed", K(errno), K(interval_us));
+  }
+}
+
+void ObCpuProfiler::sigprof_handler(int sig, siginfo_t *si, void *context)
+{
+  UNUSEDx(sig, si, context);
+  int saved_errno = errno;
+  ObCpuProfiler &profiler = get_instance();
+  if (profiler.is_inited_ && ATOMIC_LOAD(&profiler.interval_us_) > 0) {
+    profiler.record_sample();
+  }
+  errno = saved_errno;
+}
+
+void ObCpuProfiler::record_sample()
+{
+  const int64_t pos = ATOMIC_FAA(&write_pos_, 1);
+  ObCpuProfileSample &sample = list_[pos % list_.size()];
+  ATOMIC_STORE(&sample.seq_, 0);
+  MEM_BARRIER();
+  const ActiveSessionStat &stat = ObActiveSessionGuard::get_stat();
+  sample.sample_time_ = ObTimeUtility::current_time();
+  sample.tenant_id_ = 0 != stat.tenant_id_ ? stat.tenant_id_ : GET_TENANT_ID();
+  sample.session_id_ = stat.session_id_;
+  sample.tid_ = GETTID();
+  sample.plan_id_ = stat.plan_id_;
+  sample.plan_line_id_ = stat.plan_line_id_;
+  sample.event_no_ = stat.event_no_;
+  MEMCPY(sample.sql_id_, stat.sql_id_, sizeof(sample.sql_id_));
+  sample.sql_id_[sizeof(sample.sql_id_) - 1] = '\0';
+  int64_t depth = 0;
+#ifdef __x86_64__
+  if (0 != safe_backtrace_in_signal(sample.frames_, ObCpuProfileSample::MAX_STACK_DEPTH, &depth)) {
+    depth = 0;
+  }
+#endif
+  for (int64_t i = 0; i < depth; i++) {
+    sample.frames_[i] -= load_base_;
+  }
+  sample.depth_ = static_cast<int32_t>(depth);
+  MEM_BARRIER();
+  ATOMIC_STORE(&sample.seq_, pos + 1);
+}
+
+bool ObCpuProfiler::get(const int64_t pos, ObCpuProfileSample &sample) const
+{
+  bool bret = false;
+  if (list_.size() > 0 && pos >= 0 && write_pos() - pos <= list_.size()) {
+    const ObCpuProfileSample &slot = list_[pos % list_.size()];
+    if (ATOMIC_LOAD(&slot.seq_) == pos + 1) {
+      MEMCPY(&sample, &slot, sizeof(sample));
+      MEM_BARRIER();
+      bret = ATOMIC_LOAD(&slot.seq_) == pos + 1;
+    }
+  }
+  return bret;
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef _OB_SHARE_ASH_CPU_PROFILER_H_
+#define _OB_SHARE_ASH_CPU_PROFILER_H_
+
+#include <signal.h>
+#include "lib/container/ob_array.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace share
+{
+
+struct ObCpuProfileSample
+{
+  static const int64_t MAX_STACK_DEPTH = 48;
+  ObCpuProfileSample() { reset(); }
+  void reset() { MEMSET(this, 0, sizeof(*this)); plan_line_id_ = -1; }
+  TO_STRING_KV(K_(seq), K_(sample_time), K_(tenant_id), K_(session_id), K_(tid),
+               K_(plan_id), K_(plan_line_id), K_(event_no), K_(depth));
+
+  // sample id + 1 once the slot is completely written, 0 while it is being written
+  int64_t seq_;
+  int64_t sample_time_;
+  uint64_t tenant_id_;
+  uint64_t session_id_;
+  int64_t tid_;
+  uint64_t plan_id_;
+  int64_t event_no_;
+  int32_t plan_line_id_;
+  int32_t depth_;
+  char sql_id_[common::OB_MAX_SQL_ID_LENGTH + 1];
+  // return addresses relative to the load base of the observer binary, leaf first
+  uintptr_t frames_[MAX_STACK_DEPTH];
+};
+
+// ObCpuProfiler samples the stack of whichever thread is burning cpu.
+//
+// ITIMER_PROF makes the kernel deliver SIGPROF to a running thread every
+// `interval` of process cpu time, so threads are sampled in proportion to the
+// cpu they consume. The handler tags each stack with the ASH stat bound to the
+// thread (tenant, session, sql_id, plan line, wait event) and writes it into a
+// fixed ring buffer, nothing is allocated or locked in signal context.
+//
+//   * -> write_pos_
+//   +------------------+--------------------+
+//   | | | | | | | | | | | | | | | | | | | | |
+//   +------------------+--------------------+
+//
+// Like ObActiveSessHistList the buffer is regarded as an unlimited array,
+// readers walk back from write_pos_ and drop slots already overwritten.
+class ObCpuProfiler
+{
+public:
+  static ObCpuProfiler &get_instance();
+  int init();
+  void destroy();
+  // 0 stops sampling, takes effect immediately if inited, otherwise on init
+  void set_sample_interval(const int64_t interval_us);
+  int64_t get_sample_interval() const { return ATOMIC_LOAD(&interval_us_); }
+  int64_t write_pos() const { return ATOMIC_LOAD(&write_pos_); }
+  int64_t size() const { return list_.size(); }
+  // copy out sample `pos`, return false if the slot is overwritten or half written
+  bool get(const int64_t pos, ObCpuProfileSample &sample) const;
+private:
+  ObCpuProfiler();
+  ~ObCpuProfiler() = default;
+  static void sigprof_handler(int sig, siginfo_t *si, void *context);
+  int install_handler();
+  void apply_interval(const int64_t interval_us);
+  void record_sample();
+private:
+  bool is_inited_;
+  int64_t interval_us_;
+  uintptr_t load_base_;
+  int64_t write_pos_;
+  common::ObArray<ObCpuProfileSample> list_;
+  DISALLOW_COPY_AND_ASSIGN(ObCpuProfiler);
+};
+
+}
+}
+#endif /* _OB_SHARE_ASH_CPU_PROFILER_H_ */
@@ -3488,6 +3488,20 @@ int ObInnerTableSchema::all_virtual_latch_schema(ObTableSchema &table_schema)
       false, //is_nullable
       false); //is_autoincrement
   }
+  if (OB_SUCC(ret)) {
+    ADD_COLUMN_SCHEMA("wait_time_histogram", //column_name
+      ++column_id, //column_id
+      0, //rowkey_id
+      0, //index_id
+      0, //part_key_pos
+      ObVarcharType, //column_type
+      CS_TYPE_INVALID, //column_collation_type
+      OB_MAX_CHAR_LENGTH, //column_length
+      -1, //column_precision
+      -1, //column_scale
+      false, //is_nullable
+      false); //is_autoincrement
+  }
   if (OB_SUCC(ret)) {
     table_schema.get_part_option().set_part_num(1);
     table_schema.set_part_level(PARTITION_LEVEL_ONE);
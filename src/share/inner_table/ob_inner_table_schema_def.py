@@ -5741,6 +5741,7 @@ def_table_schema(
   ('immediate_misses', 'int'),
   ('spin_gets', 'int'),
   ('wait_time', 'int'),
+  ('wait_time_histogram', 'varchar:OB_MAX_CHAR_LENGTH'),
   ],
   vtable_route_policy = 'distributed',
   partition_columns = ['svr_ip', 'svr_port'],
@@ -10848,6 +10849,33 @@ def_table_schema(
 # 12360: __all_virtual_plan_table
 # 12361: __all_virtual_plan_real_info
 
+def_table_schema(
+  owner = 'nijia.nj',
+  tablegroup_id = 'OB_INVALID_ID',
+  table_name    = '__all_virtual_cpu_profile',
+  table_id      = '12362',
+  table_type = 'VIRTUAL_TABLE',
+  gm_columns    = [],
+  rowkey_columns = [],
+  in_tenant_space = False,
+  normal_columns = [
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH'),
+    ('svr_port', 'int'),
+    ('sample_id', 'int'),
+    ('sample_time', 'timestamp'),
+    ('tenant_id', 'int'),
+    ('session_id', 'int'),
+    ('thread_id', 'int'),
+    ('sql_id', 'varchar:OB_MAX_SQL_ID_LENGTH', 'false', ''),
+    ('plan_id', 'int'),
+    ('sql_plan_line_id', 'int', 'true'),
+    ('event_no', 'int'),
+    ('stack', 'varchar:1024', 'false', '')
+  ],
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
 #
 # 余留位置
 #
@@ -225,6 +225,25 @@ int ObLocationService::nonblock_renew(
   return ret;
 }
 
+int ObLocationService::prefetch(
+    const uint64_t tenant_id,
+    const common::ObIArray<ObTabletID> &tablet_ids,
+    const int64_t expire_renew_time)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", KR(ret));
+  } else if (OB_FAIL(tablet_ls_service_.prefetch(
+      tenant_id,
+      tablet_ids,
+      expire_renew_time))) {
+    LOG_WARN("fail to prefetch tablet to log stream",
+        KR(ret), K(tenant_id), K(expire_renew_time));
+  }
+  return ret;
+}
+
 int ObLocationService::vtable_get(
     const uint64_t tenant_id,
     const uint64_t table_id,
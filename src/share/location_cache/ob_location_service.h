@@ -148,6 +148,15 @@ public:
   int nonblock_renew(
       const uint64_t tenant_id,
       const ObTabletID &tablet_id);
+
+  // Renews the expired mappings of a batch of tablets with batch inner sql,
+  // so that the following get() of these tablets can hit the cache.
+  //
+  // @param [in] expire_renew_time: same as get()
+  int prefetch(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t expire_renew_time);
  // ----------------------- End interfaces for tablet to log stream -----------------------
 
   // ----------------------- Interfaces for virtual table location -------------------------
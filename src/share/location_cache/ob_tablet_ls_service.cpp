@@ -165,6 +165,52 @@ int ObTabletLSService::nonblock_renew(
   return ret;
 }
 
+int ObTabletLSService::prefetch(
+    const uint64_t tenant_id,
+    const common::ObIArray<ObTabletID> &tablet_ids,
+    const int64_t expire_renew_time)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObTabletID, 16> expired_tablet_ids;
+  ObTabletLSCache tablet_cache;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("service not init", KR(ret));
+  } else if (is_sys_tenant(tenant_id)) {
+    // do nothing
+  } else {
+    ARRAY_FOREACH(tablet_ids, i) {
+      const ObTabletID &tablet_id = tablet_ids.at(i);
+      if (!is_valid_key_(tenant_id, tablet_id) || tablet_id.is_sys_tablet()) {
+        // skip, get() will handle it
+      } else {
+        ret = get_from_cache_(tenant_id, tablet_id, tablet_cache);
+        if (OB_SUCCESS != ret && OB_CACHE_NOT_HIT != ret) {
+          LOG_WARN("get tablet location from cache failed",
+              KR(ret), K(tenant_id), K(tablet_id));
+        } else if (OB_CACHE_NOT_HIT == ret
+            || tablet_cache.get_renew_time() <= expire_renew_time) {
+          if (OB_FAIL(expired_tablet_ids.push_back(tablet_id))) {
+            LOG_WARN("fail to push back", KR(ret), K(tablet_id));
+          }
+        }
+      }
+    }
+    // a single tablet is left for get() to renew
+    const int64_t count = expired_tablet_ids.count();
+    for (int64_t start_idx = 0;
+         OB_SUCC(ret) && count > 1 && start_idx < count;
+         start_idx += BATCH_RENEW_TABLET_COUNT) {
+      const int64_t end_idx = min(start_idx + BATCH_RENEW_TABLET_COUNT, count);
+      if (OB_FAIL(batch_renew_cache_(tenant_id, expired_tablet_ids, start_idx, end_idx))) {
+        LOG_WARN("fail to batch renew tablet cache",
+            KR(ret), K(tenant_id), K(start_idx), K(end_idx));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTabletLSService::add_update_task(const ObTabletLSUpdateTask &task)
 {
   int ret = OB_SUCCESS;
@@ -205,24 +251,32 @@ int ObTabletLSService::batch_process_tasks(
         LOG_WARN("tenant schema is not ready, need wait", KR(ret), K(meta_tenant_id), K(tasks));
       }
     } else {
+      // tasks of a batch belong to the same tenant, renew them with batch inner sql
+      const uint64_t tenant_id = tasks.at(0).get_tenant_id();
+      ObSEArray<ObTabletID, 16> tablet_ids;
       ObTabletLSCache tablet_cache;
       ARRAY_FOREACH_NORET(tasks, i) {
-        tablet_cache.reset();
         const ObTabletLSUpdateTask &task = tasks.at(i);
-        if (OB_UNLIKELY(!task.is_valid())) {
+        if (OB_UNLIKELY(!task.is_valid() || tenant_id != task.get_tenant_id())) {
           tmp_ret = OB_INVALID_ARGUMENT;
-          LOG_WARN("invalid task", KR(tmp_ret), K(task));
-        } else {
-          tmp_ret = renew_cache_(
-              task.get_tenant_id(),
-              task.get_tablet_id(),
-              tablet_cache);
-          if (OB_SUCCESS != tmp_ret) {
+          LOG_WARN("invalid task", KR(tmp_ret), K(task), K(tenant_id));
+        } else if (is_sys_tenant(tenant_id) || task.get_tablet_id().is_sys_tablet()) {
+          // not kept in __all_tablet_to_ls
+          if (OB_SUCCESS != (tmp_ret = renew_cache_(
+              tenant_id, task.get_tablet_id(), tablet_cache))) {
             ret = tmp_ret;
             LOG_WARN("fail to renew tablet_cache", KR(ret), K(task));
           }
+        } else if (OB_SUCCESS != (tmp_ret = tablet_ids.push_back(task.get_tablet_id()))) {
+          ret = tmp_ret;
+          LOG_WARN("fail to push back", KR(ret), K(task));
         }
       } // end foreach
+      if (OB_SUCCESS != (tmp_ret = renew_tablets_(tenant_id, tablet_ids))) {
+        ret = tmp_ret;
+        LOG_WARN("fail to renew tablets",
+            KR(ret), K(tenant_id), "tablet_count", tablet_ids.count());
+      }
     }
   }
   return ret;
@@ -350,6 +404,75 @@ int ObTabletLSService::renew_cache_(
   return ret;
 }
 
+int ObTabletLSService::batch_renew_cache_(
+    const uint64_t tenant_id,
+    const common::ObIArray<ObTabletID> &tablet_ids,
+    const int64_t start_idx,
+    const int64_t end_idx)
+{
+  int ret = OB_SUCCESS;
+  ObTimeoutCtx ctx;
+  ObSEArray<ObTabletLSCache, 16> tablet_caches;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("service not init", KR(ret));
+  } else if (OB_UNLIKELY(OB_INVALID_TENANT_ID == tenant_id
+      || start_idx < 0
+      || start_idx >= end_idx
+      || end_idx > tablet_ids.count()
+      || end_idx - start_idx > BATCH_RENEW_TABLET_COUNT)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(tenant_id), K(start_idx), K(end_idx),
+        "tablet_count", tablet_ids.count());
+  } else if (OB_FAIL(set_timeout_ctx_(ctx))) {
+    LOG_WARN("failed to set timeout ctx", KR(ret));
+  } else if (OB_FAIL(inner_batch_get_by_sql_(
+      tenant_id, tablet_ids, start_idx, end_idx, tablet_caches))) {
+    LOG_WARN("fail to inner batch get by sql",
+        KR(ret), K(tenant_id), K(start_idx), K(end_idx));
+    if (ObLocationServiceUtility::treat_sql_as_timeout(ret)) {
+      ret = OB_GET_LOCATION_TIME_OUT;
+    }
+  } else {
+    ARRAY_FOREACH(tablet_caches, i) {
+      if (OB_FAIL(update_cache_(tablet_caches.at(i)))) {
+        LOG_WARN("fail to update cache", KR(ret), K(tablet_caches.at(i)));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ObTaskController::get().allow_next_syslog();
+      LOG_INFO("LOCATION:success to batch renew tablet cache", K(tenant_id),
+          "tablet_count", end_idx - start_idx, "found_count", tablet_caches.count());
+    }
+  }
+  return ret;
+}
+
+int ObTabletLSService::renew_tablets_(
+    const uint64_t tenant_id,
+    const common::ObIArray<ObTabletID> &tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  ObTabletLSCache tablet_cache;
+  const int64_t count = tablet_ids.count();
+  for (int64_t start_idx = 0; start_idx < count; start_idx += BATCH_RENEW_TABLET_COUNT) {
+    const int64_t end_idx = min(start_idx + BATCH_RENEW_TABLET_COUNT, count);
+    if (OB_SUCCESS != (tmp_ret = batch_renew_cache_(tenant_id, tablet_ids, start_idx, end_idx))) {
+      LOG_WARN("fail to batch renew tablet_cache, renew one by one",
+          KR(tmp_ret), K(tenant_id), K(start_idx), K(end_idx));
+      // same as before batch renew, a bad tablet or a too large sql does not fail the others
+      for (int64_t idx = start_idx; idx < end_idx; ++idx) {
+        if (OB_SUCCESS != (tmp_ret = renew_cache_(tenant_id, tablet_ids.at(idx), tablet_cache))) {
+          ret = tmp_ret;
+          LOG_WARN("fail to renew tablet_cache", KR(ret), K(tenant_id), K(tablet_ids.at(idx)));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTabletLSService::update_cache_(const ObTabletLSCache &tablet_cache)
 {
   int ret = OB_SUCCESS;
@@ -427,6 +550,84 @@ int ObTabletLSService::inner_get_by_sql_(
   return ret;
 }
 
+int ObTabletLSService::inner_batch_get_by_sql_(
+    const uint64_t tenant_id,
+    const common::ObIArray<ObTabletID> &tablet_ids,
+    const int64_t start_idx,
+    const int64_t end_idx,
+    common::ObIArray<ObTabletLSCache> &tablet_caches)
+{
+  int ret = OB_SUCCESS;
+  ObSqlString sql;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("service not init", KR(ret));
+  } else if (OB_ISNULL(sql_proxy_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sql proxy is null", KR(ret));
+  } else if (OB_UNLIKELY(OB_INVALID_TENANT_ID == tenant_id
+      || start_idx < 0
+      || start_idx >= end_idx
+      || end_idx > tablet_ids.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", KR(ret), K(tenant_id), K(start_idx), K(end_idx));
+  } else if (OB_FAIL(sql.assign_fmt(
+      "SELECT tablet_id, ls_id, ORA_ROWSCN from %s WHERE tablet_id IN (",
+      OB_ALL_TABLET_TO_LS_TNAME))) {
+    LOG_WARN("fail to assign sql", KR(ret));
+  } else {
+    for (int64_t idx = start_idx; OB_SUCC(ret) && idx < end_idx; ++idx) {
+      if (OB_FAIL(sql.append_fmt("%s%lu", start_idx == idx ? "" : ", ",
+                                 tablet_ids.at(idx).id()))) {
+        LOG_WARN("fail to append sql", KR(ret), K(idx));
+      }
+    }
+    if (FAILEDx(sql.append(")"))) {
+      LOG_WARN("fail to append sql", KR(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    SMART_VAR(ObMySQLProxy::MySQLResult, res) {
+      sqlclient::ObMySQLResult *result = NULL;
+      const int64_t now = ObTimeUtility::current_time();
+      ObTabletLSCache tablet_cache;
+      if (OB_FAIL(sql_proxy_->read(res, tenant_id, sql.ptr()))) {
+        LOG_WARN("fail to execute sql", KR(ret), K(tenant_id), K(sql));
+      } else if (OB_ISNULL(result = res.get_result())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("fail to get sql result", KR(ret));
+      }
+      while (OB_SUCC(ret) && OB_SUCC(result->next())) {
+        uint64_t tablet_id = ObTabletID::INVALID_TABLET_ID;
+        int64_t int_ls_id = ObLSID::INVALID_LS_ID;
+        int64_t row_scn = 0;
+        tablet_cache.reset();
+        EXTRACT_INT_FIELD_MYSQL(*result, "tablet_id", tablet_id, uint64_t);
+        EXTRACT_INT_FIELD_MYSQL(*result, "ls_id", int_ls_id, int64_t);
+        EXTRACT_INT_FIELD_MYSQL(*result, "ORA_ROWSCN", row_scn, int64_t);
+        if (FAILEDx(tablet_cache.init(
+            tenant_id,
+            ObTabletID(tablet_id),
+            ObLSID(int_ls_id),
+            now,
+            row_scn))) {
+          LOG_WARN("init tablet_cache failed", KR(ret), K(tenant_id),
+              K(tablet_id), K(int_ls_id), K(now), K(row_scn));
+        } else if (OB_FAIL(tablet_caches.push_back(tablet_cache))) {
+          LOG_WARN("fail to push back", KR(ret), K(tablet_cache));
+        }
+      }
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+        LOG_TRACE("success to batch get tablet by sql", K(tenant_id), K(tablet_caches));
+      } else {
+        LOG_WARN("fail to batch get tablet by sql", KR(ret), K(tenant_id), K(sql));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTabletLSService::set_timeout_ctx_(common::ObTimeoutCtx &ctx)
 {
   int ret = OB_SUCCESS;
@@ -64,6 +64,17 @@ public:
   int nonblock_renew(
       const uint64_t tenant_id,
       const ObTabletID &tablet_id);
+  // Renews the mappings of tablets which are missing in cache or older than expire_renew_time
+  // by batch inner sql, so that the following get() of these tablets can hit the cache.
+  // Mappings not found in sys table are ignored and left for get() to report.
+  //
+  // @param [in] tenant_id: target tenant which the tablets belong to
+  // @param [in] tablet_ids: tablets to be prefetched
+  // @param [in] expire_renew_time: same as get()
+  int prefetch(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t expire_renew_time);
   // Add update task into async_queue_.
   int add_update_task(const ObTabletLSUpdateTask &task);
   // Process update tasks.
@@ -86,16 +97,33 @@ private:
       const uint64_t tenant_id,
       const ObTabletID &tablet_id,
       ObTabletLSCache &tablet_cache);
+  // renew tablet_ids[start_idx, end_idx) with one inner sql, at most BATCH_RENEW_TABLET_COUNT
+  int batch_renew_cache_(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t start_idx,
+      const int64_t end_idx);
+  // renew tablets by batch, tablets of a failed batch are renewed one by one
+  int renew_tablets_(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids);
   int update_cache_(const ObTabletLSCache &tablet_cache);
   int inner_get_by_sql_(
       const uint64_t tenant_id,
       const ObTabletID &tablet_id,
       ObTabletLSCache &tablet_cache);
+  int inner_batch_get_by_sql_(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t start_idx,
+      const int64_t end_idx,
+      common::ObIArray<ObTabletLSCache> &tablet_caches);
   int set_timeout_ctx_(common::ObTimeoutCtx &ctx);
   bool is_valid_key_(const uint64_t tenant_id, const ObTabletID &tablet_id) const;
   const int64_t MINI_MODE_UPDATE_THREAD_CNT = 1;
   const int64_t USER_TASK_QUEUE_SIZE = 200 * 1000; // 20W partitions
   const int64_t MINI_MODE_USER_TASK_QUEUE_SIZE = 10 * 1000; // 1W partitions
+  const int64_t BATCH_RENEW_TABLET_COUNT = 200; // tablets per inner sql
 
   bool inited_;
   bool stopped_;
@@ -133,6 +133,11 @@ DEF_TIME(dead_socket_detection_timeout, OB_CLUSTER_PARAMETER, "3s", "[0s,2h]",
 DEF_BOOL(enable_perf_event, OB_CLUSTER_PARAMETER, "True",
          "specifies whether to enable perf event feature. The default value is True.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_cpu_profile_sample_interval, OB_CLUSTER_PARAMETER, "0ms", "[0ms, 1s]",
+         "process cpu time between two stack samples of the in-process cpu profiler, "
+         "samples are exposed by __all_virtual_cpu_profile. 0 disables the profiler. "
+         "Range: [0ms, 1s]",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_upgrade_mode, OB_CLUSTER_PARAMETER, "False",
          "specifies whether upgrade mode is turned on. "
          "If turned on, daily merger and balancer will be disabled. "
@@ -225,6 +230,10 @@ DEF_STR_WITH_CHECKER(tableapi_transport_compress_func, OB_CLUSTER_PARAMETER, "no
                      common::ObConfigCompressFuncChecker,
                      "compressor used for tableAPI query result. Values: none, lz4_1.0, snappy_1.0, zlib_1.0, zstd_1.0 zstd 1.3.8",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_tableapi_query_prefetch, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether tableAPI sync query scans the next batch right after responding the current one. "
+         "Value: True: turned on; False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(_sort_area_size, OB_TENANT_PARAMETER, "128M", "[2M,]",
         "size of maximum memory that could be used by SORT. Range: [2M,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -341,6 +350,11 @@ DEF_INT(writing_throttling_trigger_percentage, OB_TENANT_PARAMETER, "60", "(0, 1
 DEF_TIME(writing_throttling_maximum_duration, OB_TENANT_PARAMETER, "2h", "[1s, 3d]",
           "maximum duration of writting throttling(in minutes), max value is 3 days",
           ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_writing_throttling_predictive_horizon, OB_TENANT_PARAMETER, "0s", "[0s, 1h]",
+          "writes are slowed down before writing_throttling_trigger_percentage is reached if the memstore "
+          "is predicted to reach it within this horizon at the current write and freeze rate. "
+          "setting 0 means turn off predictive writing limit",
+          ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(plan_cache_high_watermark, OB_CLUSTER_PARAMETER, "2000M",
         "(don't use now) memory usage at which plan cache eviction will be trigger immediately. Range: [0, +∞)",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -665,6 +679,11 @@ DEF_TIME(_ob_get_gts_ahead_interval, OB_CLUSTER_PARAMETER, "0s", "[0s, 1s]",
 DEF_TIME(rpc_timeout, OB_CLUSTER_PARAMETER, "2s",
          "the time during which a RPC request is permitted to execute before it is terminated",
          ObParameterAttr(Section::RPC, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_batch_rpc_coalesce_window, OB_CLUSTER_PARAMETER, "0us", "[0us, 1ms]",
+         "the time the no-delay batch rpc sender of transaction and sql messages waits after being woken up, "
+         "so that messages to the same destination are coalesced into one packet. 0 means send immediately. "
+         "Range: [0us, 1ms]",
+         ObParameterAttr(Section::RPC, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 //// location cache config
 DEF_TIME(virtual_table_location_cache_expire_time, OB_CLUSTER_PARAMETER, "8s", "[1s,)",
@@ -746,6 +765,11 @@ DEF_BOOL(_enable_parallel_minor_merge, OB_TENANT_PARAMETER, "True",
          "specifies whether enable parallel minor merge. "
          "Value: True:turned on;  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_adaptive_dag_concurrency, OB_TENANT_PARAMETER, "False",
+         "specifies whether lower the concurrency of minor merge, major merge, low priority migration and ddl dags "
+         "under foreground request backlog, user io latency or cpu pressure, and restore it when idle. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(compaction_low_thread_score, OB_TENANT_PARAMETER, "0", "[0,100]",
         "the current work thread score of low priority compaction. Range: [0,100] in integer. Especially, 0 means default value",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1085,6 +1109,11 @@ DEF_STR_WITH_CHECKER(use_large_pages, OB_CLUSTER_PARAMETER, "false",
                      "used to manage the database's use of large pages, "
                      "values: false, true, only",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_STR(_large_page_ctx_list, OB_CLUSTER_PARAMETER, "",
+        "memory contexts whose chunks may be backed by large pages when use_large_pages is enabled, "
+        "separated by comma, e.g. KVSTORE_CACHE_ID,MEMSTORE_CTX_ID,WORK_AREA. "
+        "empty means all contexts",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_STR(ob_ssl_invited_common_names, OB_TENANT_PARAMETER, "NONE",
         "when server use ssl, use it to control client identity with ssl subject common name. default NONE",
@@ -1139,6 +1168,9 @@ DEF_INT(open_cursors, OB_TENANT_PARAMETER, "50", "[0,65535]",
 DEF_BOOL(_enable_px_batch_rescan, OB_TENANT_PARAMETER, "True",
          "enable px batch rescan for nlj or subplan filter",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_spf_batch_rescan, OB_TENANT_PARAMETER, "False",
+         "enable das batch rescan for subplan filter",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_INT(_parallel_max_active_sessions, OB_TENANT_PARAMETER, "0", "[0,]",
         "max active parallel sessions allowed for tenant. Range: [0,+∞)",
@@ -52,6 +52,25 @@ inline bool is_hp_rpc(const int batch_type)
   return (batch_type >= 0 && batch_type < BATCH_REQ_TYPE_COUNT) ? hp_rpc_map[batch_type] : false;
 }
 
+// batch types whose no-delay sender may hold a wakeup for _batch_rpc_coalesce_window,
+// so that messages posted to the same destination meanwhile share one OB_BATCH packet.
+// clog and election keep sending immediately.
+inline bool is_coalescable_batch(const int batch_type)
+{
+  static const bool coalesce_map[BATCH_REQ_TYPE_COUNT] = {false, false, false, false, true, true, true, false};
+  return (batch_type >= 0 && batch_type < BATCH_REQ_TYPE_COUNT) ? coalesce_map[batch_type] : false;
+}
+
+// time the no-delay sender holds a wakeup before sending, 0 to send right away.
+// Only a wakeup by a poster is held, on timeout the buffers already had the whole wait to fill.
+inline int64_t get_batch_coalesce_wait_us(const int batch_type,
+                                          const bool is_signaled,
+                                          const int64_t coalesce_window_us)
+{
+  return (is_signaled && coalesce_window_us > 0 && is_coalescable_batch(batch_type)) ?
+      coalesce_window_us : 0;
+}
+
 inline int get_batch_thread_idx(const int batch_type)
 {
   RLOCAL_INLINE(int, scount);
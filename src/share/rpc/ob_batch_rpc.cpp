@@ -339,7 +339,14 @@ void ObBatchRpcBase::do_work()
     if (delay_us_ > 0) {
       ob_usleep((int32_t)sleep_ts);
     } else {
-      cond_.wait(sleep_ts);
+      const bool is_signaled = cond_.wait(sleep_ts);
+      const int64_t coalesce_wait_us = get_batch_coalesce_wait_us(
+          batch_type_, is_signaled, GCONF._batch_rpc_coalesce_window);
+      if (coalesce_wait_us > 0) {
+        // woken up by a poster, let concurrent posters to the same destinations fill
+        // the current buffers before the next round freezes and sends them
+        ob_usleep((int32_t)coalesce_wait_us);
+      }
     }
   }
 }
@@ -326,16 +326,15 @@ public:
       }
     }
   }
+  // return true if signaled before or during the wait, false on timeout.
+  // The signal is consumed by one exchange, so it is reported by exactly one wait.
   bool wait(int64_t timeout)  {
-    bool ready = ATOMIC_LOAD(&futex_.val());
-    if (!ready) {
+    if (!ATOMIC_LOAD(&futex_.val())) {
       ATOMIC_FAA(&n_waiters_, 1);
       futex_.wait(0, timeout);
       ATOMIC_FAA(&n_waiters_, -1);
-    } else {
-      ATOMIC_STORE(&futex_.val(), 0);
     }
-    return ready;
+    return 0 != ATOMIC_SET(&futex_.val(), 0);
   }
 private:
   int32_t n_waiters_;
@@ -18,6 +18,7 @@
 #include "share/rc/ob_tenant_base.h"
 #include "share/ob_force_print_log.h"
 #include "share/scheduler/ob_dag_scheduler.h"
+#include "share/io/ob_io_manager.h"
 #include "share/scheduler/ob_sys_task_stat.h"
 #include "share/rc/ob_context.h"
 #include "observer/omt/ob_tenant.h"
@@ -1478,6 +1479,8 @@ ObTenantDagScheduler::ObTenantDagScheduler()
     work_thread_num_(0),
     default_work_thread_num_(0),
     total_running_task_cnt_(0),
+    user_io_rt_baseline_(0),
+    cpu_usage_(),
     tg_id_(-1)
 {
 }
@@ -1685,6 +1688,7 @@ void ObTenantDagScheduler::get_default_config()
   for (int64_t i = 0; i < ObDagPrio::DAG_PRIO_MAX; ++i) { // calc sum of default_low_limit
     low_limits_[i] = OB_DAG_PRIOS[i].score_; // temp solution
     up_limits_[i] = OB_DAG_PRIOS[i].score_;
+    adaptive_limits_[i] = up_limits_[i];
     threads_sum += up_limits_[i];
   }
   work_thread_num_ = threads_sum;
@@ -1820,6 +1824,7 @@ void ObTenantDagScheduler::dump_dag_status()
     int32_t running_task[ObDagPrio::DAG_PRIO_MAX];
     int32_t low_limits[ObDagPrio::DAG_PRIO_MAX];
     int32_t up_limits[ObDagPrio::DAG_PRIO_MAX];
+    int32_t adaptive_limits[ObDagPrio::DAG_PRIO_MAX];
     int64_t dag_count[ObDagType::DAG_TYPE_MAX];
     int64_t dag_net_count[ObDagNetType::DAG_NET_TYPE_MAX];
     int64_t ready_dag_count[ObDagPrio::DAG_PRIO_MAX];
@@ -1830,6 +1835,7 @@ void ObTenantDagScheduler::dump_dag_status()
         running_task[i] = running_task_cnts_[i];
         low_limits[i] = low_limits_[i];
         up_limits[i] = up_limits_[i];
+        adaptive_limits[i] = adaptive_limits_[i];
         ready_dag_count[i] = dag_list_[READY_DAG_LIST].size(i);
         waiting_dag_count[i] = dag_list_[WAITING_DAG_LIST].size(i);
       }
@@ -1853,6 +1859,7 @@ void ObTenantDagScheduler::dump_dag_status()
       COMMON_LOG(INFO, "dump_dag_status", "priority", OB_DAG_PRIOS[i].dag_prio_str_,
           "low_limit", low_limits[i],
           "up_limit", up_limits[i],
+          "adaptive_limit", adaptive_limits[i],
           "running_task", running_task[i],
           "ready_dag_count", ready_dag_count[i],
           "waiting_dag_count", waiting_dag_count[i]);
@@ -2137,6 +2144,9 @@ void ObTenantDagScheduler::run1()
   while (!has_set_stop()) {
     dump_dag_status();
     loop_dag_net();
+    if (REACH_TENANT_TIME_INTERVAL(ADJUST_CONCURRENCY_INTERVAL)) {
+      adjust_concurrency();
+    }
     {
       ObThreadCondGuard guard(scheduler_sync_);
       if (!has_set_stop()) {
@@ -2818,9 +2828,10 @@ int ObTenantDagScheduler::loop_ready_dag_lists()
   bool is_found = false;
   if (total_running_task_cnt_ < work_thread_num_) {
     for (int64_t i = 0; OB_SUCC(ret) && !is_found && i < ObDagPrio::DAG_PRIO_MAX; ++i) {
-      if (running_task_cnts_[i] < low_limits_[i]) {
+      const int32_t low_limit = get_concurrency_limit(i, low_limits_[i]);
+      if (running_task_cnts_[i] < low_limit) {
         is_found = (OB_SUCCESS == schedule_one(i));
-        while (running_task_cnts_[i] < low_limits_[i] && is_found) {
+        while (running_task_cnts_[i] < low_limit && is_found) {
           if (OB_SUCCESS != schedule_one(i)) {
             break;
           }
@@ -2829,9 +2840,10 @@ int ObTenantDagScheduler::loop_ready_dag_lists()
     }
 
     for (int64_t i = 0; OB_SUCC(ret) && !is_found && i < ObDagPrio::DAG_PRIO_MAX; ++i) {
-      if (running_task_cnts_[i] < up_limits_[i]) {
+      const int32_t up_limit = get_concurrency_limit(i, up_limits_[i]);
+      if (running_task_cnts_[i] < up_limit) {
         is_found = (OB_SUCCESS == schedule_one(i));
-        while (running_task_cnts_[i] < up_limits_[i] && is_found) {
+        while (running_task_cnts_[i] < up_limit && is_found) {
           if (OB_SUCCESS != schedule_one(i)) {
             break;
           }
@@ -2956,6 +2968,123 @@ void ObTenantDagScheduler::update_work_thread_num()
   work_thread_num_ = threads_sum; 
 }
 
+bool ObTenantDagScheduler::is_adaptive_prio(const int64_t priority)
+{
+  // mini merge releases memstore and high priority ha/ddl dags are waited by users,
+  // never slow them down
+  return ObDagPrio::DAG_PRIO_COMPACTION_MID == priority
+      || ObDagPrio::DAG_PRIO_COMPACTION_LOW == priority
+      || ObDagPrio::DAG_PRIO_HA_LOW == priority
+      || ObDagPrio::DAG_PRIO_DDL == priority;
+}
+
+// is_busy: foreground requests are queued beyond worker threads, user read latency
+//          rises well above its normal level or the cpu is nearly saturated.
+// is_idle: no foreground request is queued, user read latency is normal and the cpu
+//          has headroom.
+void ObTenantDagScheduler::get_load_feedback(bool &is_busy, bool &is_idle)
+{
+  int ret = OB_SUCCESS;
+  is_busy = false;
+  is_idle = true;
+
+  omt::ObTenant *tenant = static_cast<omt::ObTenant*>(share::ObTenantEnv::get_tenant());
+  if (OB_NOT_NULL(tenant)) {
+    const int64_t req_queue_length = tenant->get_request_queue_length();
+    if (req_queue_length > tenant->token_cnt()) {
+      is_busy = true;
+    }
+    if (req_queue_length > 0) {
+      is_idle = false;
+    }
+  }
+
+  ObRefHolder<ObTenantIOManager> tenant_holder;
+  if (OB_FAIL(OB_IO_MANAGER.get_tenant_io_manager(MTL_ID(), tenant_holder))) {
+    COMMON_LOG(DEBUG, "failed to get tenant io manager", K(ret));
+  } else {
+    ObIOUsage::AvgItems avg_iops, avg_bytes, avg_rt_us;
+    tenant_holder.get_ptr()->get_io_usage().get_io_usage(avg_iops, avg_bytes, avg_rt_us);
+    const double user_read_rt_us =
+        avg_rt_us[static_cast<int>(ObIOCategory::USER_IO)][static_cast<int>(ObIOMode::READ)];
+    if (check_user_io_busy(user_read_rt_us, is_busy, user_io_rt_baseline_)) {
+      is_busy = true;
+      is_idle = false;
+    }
+  }
+
+  double cpu_usage_pct = 0;
+  cpu_usage_.get_cpu_usage(cpu_usage_pct);
+  const int64_t cpu_cnt = get_nprocs();
+  if (cpu_cnt > 0 && cpu_usage_pct > cpu_cnt * BUSY_CPU_USAGE_PCT) {
+    is_busy = true;
+    is_idle = false;
+  }
+}
+
+// While busy the baseline still follows current latency but much more slowly,
+// so a higher latency level lasting for a while becomes the new baseline and
+// does not keep the concurrency clamped forever.
+bool ObTenantDagScheduler::check_user_io_busy(
+    const double user_read_rt_us,
+    const bool is_other_busy,
+    double &baseline)
+{
+  bool is_io_busy = false;
+  if (user_read_rt_us <= 0) {
+    // no user read in the last period
+  } else if (baseline <= 0) {
+    baseline = user_read_rt_us;
+  } else {
+    is_io_busy = user_read_rt_us > MIN_BUSY_USER_IO_RT_US
+        && user_read_rt_us > baseline * BUSY_USER_IO_RT_RATIO;
+    const int64_t weight = (is_io_busy || is_other_busy)
+        ? BUSY_USER_IO_RT_BASELINE_WEIGHT : USER_IO_RT_BASELINE_WEIGHT;
+    baseline = (baseline * (weight - 1) + user_read_rt_us) / weight;
+  }
+  return is_io_busy;
+}
+
+void ObTenantDagScheduler::adjust_concurrency()
+{
+  bool is_enabled = false;
+  bool is_busy = false;
+  bool is_idle = false;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      is_enabled = tenant_config->_enable_adaptive_dag_concurrency;
+    }
+  }
+  if (is_enabled) {
+    get_load_feedback(is_busy, is_idle);
+  }
+
+  ObThreadCondGuard guard(scheduler_sync_);
+  bool raised = false;
+  for (int64_t i = 0; i < ObDagPrio::DAG_PRIO_MAX; ++i) {
+    const int32_t old_limit = adaptive_limits_[i];
+    if (!is_enabled || !is_adaptive_prio(i)) {
+      adaptive_limits_[i] = up_limits_[i];
+    } else if (is_busy) {
+      // multiplicative decrease, running tasks are not interrupted and finish normally
+      adaptive_limits_[i] = MAX(MIN_ADAPTIVE_CONCURRENCY, MIN(adaptive_limits_[i], up_limits_[i]) / 2);
+    } else if (is_idle) {
+      // additive increase up to the configured thread score
+      adaptive_limits_[i] = MIN(up_limits_[i], adaptive_limits_[i] + 1);
+    }
+    if (old_limit != adaptive_limits_[i]) {
+      raised = raised || adaptive_limits_[i] > old_limit;
+      COMMON_LOG(INFO, "adjust dag concurrency", "prio", OB_DAG_PRIOS[i].dag_prio_str_,
+          K(old_limit), "new_limit", adaptive_limits_[i], "up_limit", up_limits_[i],
+          K(is_busy), K(is_idle), K_(user_io_rt_baseline));
+    }
+  }
+  if (raised) {
+    scheduler_sync_.signal();
+  }
+}
+
 int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int32_t score)
 {
   int ret = OB_SUCCESS;
@@ -2971,6 +3100,7 @@ int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int32_t
     up_limits_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
     low_limits_[priority] = up_limits_[priority];
     if (old_val != up_limits_[priority]) {
+      adaptive_limits_[priority] = up_limits_[priority];
       update_work_thread_num();
     }
     scheduler_sync_.signal();
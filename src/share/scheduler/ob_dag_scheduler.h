@@ -21,6 +21,7 @@
 #include "lib/lock/ob_thread_cond.h"
 #include "lib/lock/ob_mutex.h"
 #include "lib/profile/ob_trace_id.h"
+#include "share/io/ob_io_struct.h"
 #include "share/rc/ob_tenant_base.h"
 #include "share/scheduler/ob_dag_scheduler_config.h"
 
@@ -840,6 +841,13 @@ private:
   static const int64_t LOOP_PRINT_LOG_INTERVAL = 30 * 1000 * 1000L; // 30s
   static const int32_t MAX_SHOW_DAG_CNT_PER_PRIO = 100;
   static const int32_t MAX_SHOW_DAG_NET_CNT_PER_PRIO = 500;
+  static const int64_t ADJUST_CONCURRENCY_INTERVAL = 1 * 1000 * 1000L; // 1s
+  static const int64_t BUSY_USER_IO_RT_RATIO = 2;
+  static const int64_t MIN_BUSY_USER_IO_RT_US = 1000L; // 1ms
+  static const int64_t USER_IO_RT_BASELINE_WEIGHT = 8;
+  static const int64_t BUSY_USER_IO_RT_BASELINE_WEIGHT = 32;
+  static const int64_t BUSY_CPU_USAGE_PCT = 90;
+  static const int32_t MIN_ADAPTIVE_CONCURRENCY = 1;
 private:
   enum DagNetMapIndex
   {
@@ -873,6 +881,16 @@ private:
   void dump_dag_status();
   int check_need_load_shedding(const int64_t priority, const bool for_schedule, bool &need_shedding);
   void update_work_thread_num();
+  // feedback concurrency control for background priorities, see _enable_adaptive_dag_concurrency
+  void adjust_concurrency();
+  void get_load_feedback(bool &is_busy, bool &is_idle);
+  static bool is_adaptive_prio(const int64_t priority);
+  // update the user read rt baseline, return true if current rt is well above it
+  static bool check_user_io_busy(const double user_read_rt_us, const bool is_other_busy, double &baseline);
+  OB_INLINE int32_t get_concurrency_limit(const int64_t priority, const int32_t limit) const
+  {
+    return MIN(limit, adaptive_limits_[priority]);
+  }
   int move_dag_to_list_(
       ObIDag *dag,
       ObDagListIndex from_list_index,
@@ -917,6 +935,9 @@ private:
   int32_t running_task_cnts_[ObDagPrio::DAG_PRIO_MAX];
   int32_t low_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
   int32_t up_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
+  int32_t adaptive_limits_[ObDagPrio::DAG_PRIO_MAX]; // concurrency lowered by load feedback
+  double user_io_rt_baseline_; // average user read rt when foreground is not busy
+  common::ObCpuUsage cpu_usage_;
   int64_t dag_cnts_[ObDagType::DAG_TYPE_MAX];
   int64_t dag_net_cnts_[ObDagNetType::DAG_NET_TYPE_MAX];
   common::ObConcurrentFIFOAllocator allocator_;
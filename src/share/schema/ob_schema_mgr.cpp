@@ -4762,7 +4762,9 @@ void ObSchemaMgr::dump() const
            K_(tenant_id),
            K_(schema_version),
            K(schema_count),
-           K(schema_size));
+           K(schema_size),
+           "shared_table_id_map_chunks", table_id_map_.shared_chunk_count(),
+           "shared_table_name_map_chunks", table_name_map_.shared_chunk_count());
 
   #define DUMP_SCHEMA(SCHEMA, SCHEMA_TYPE, SCHEMA_ITER)   \
     {                                                     \
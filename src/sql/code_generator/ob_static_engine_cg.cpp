@@ -3802,6 +3802,8 @@ int ObStaticEngineCG::construct_hash_elements_for_connect_by(ObLogJoin &op, ObNL
   } else {
     const ObRelIds &left_table_set = left_op->get_table_set();
     const ObRelIds &right_table_set = right_op->get_table_set();
+    ObSEArray<ObExpr *, 4> hash_key_exprs;
+    ObSEArray<ObExpr *, 4> hash_probe_exprs;
     for (int64_t i = 0; OB_SUCC(ret) && i < op.get_other_join_conditions().count(); i++) {
       ObRawExpr *other_cond = op.get_other_join_conditions().at(i);
       if (OB_ISNULL(other_cond)) {
@@ -3836,15 +3838,21 @@ int ObStaticEngineCG::construct_hash_elements_for_connect_by(ObLogJoin &op, ObNL
               LOG_WARN("generate left expr failed", K(ret));
             } else if (OB_FAIL(generate_rt_expr(*other_cond->get_param_expr(1), right_param))) {
               LOG_WARN("generate right expr failed", K(ret));
-            } else if (OB_FAIL(spec.hash_key_exprs_.push_back(prior_at_left ? right_param : left_param))) {
+            } else if (OB_FAIL(hash_key_exprs.push_back(prior_at_left ? right_param : left_param))) {
               LOG_WARN("push back hash key expr failed", K(ret));
-            } else if (OB_FAIL(spec.hash_probe_exprs_.push_back(prior_at_left ? left_param : right_param))) {
+            } else if (OB_FAIL(hash_probe_exprs.push_back(prior_at_left ? left_param : right_param))) {
               LOG_WARN("push back hash probe expr failed", K(ret));
             }
           }
         }
       }
     }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(spec.hash_key_exprs_.assign(hash_key_exprs))) {
+      LOG_WARN("assign hash key exprs failed", K(ret));
+    } else if (OB_FAIL(spec.hash_probe_exprs_.assign(hash_probe_exprs))) {
+      LOG_WARN("assign hash probe exprs failed", K(ret));
+    }
   }
   return ret;
 }
@@ -646,9 +646,19 @@ int ObDASLocationRouter::nonblock_get_readable_replica(const uint64_t tenant_id,
 int ObDASLocationRouter::get(const ObDASTableLocMeta &loc_meta,
                              const common::ObTabletID &tablet_id,
                              ObLSLocation &location)
+{
+  bool is_tablet_cache_hit = false;
+  return get(loc_meta, tablet_id, location, is_tablet_cache_hit);
+}
+
+int ObDASLocationRouter::get(const ObDASTableLocMeta &loc_meta,
+                             const common::ObTabletID &tablet_id,
+                             ObLSLocation &location,
+                             bool &is_tablet_cache_hit)
 {
   int ret = OB_SUCCESS;
   uint64_t tenant_id = MTL_ID();
+  is_tablet_cache_hit = true;
   bool is_vt = is_virtual_table(loc_meta.ref_table_id_);
   bool is_mapping_real_vt = is_oracle_mapping_real_virtual_table(loc_meta.ref_table_id_);
   uint64_t ref_table_id = loc_meta.ref_table_id_;
@@ -670,6 +680,7 @@ int ObDASLocationRouter::get(const ObDASTableLocMeta &loc_meta,
                                             is_cache_hit,
                                             ls_id))) {
       LOG_WARN("nonblock get ls id failed", K(ret));
+    } else if (FALSE_IT(is_tablet_cache_hit = is_cache_hit)) {
     } else if (OB_FAIL(GCTX.location_service_->get(GCONF.cluster_id,
                                             tenant_id,
                                             ls_id,
@@ -683,6 +694,26 @@ int ObDASLocationRouter::get(const ObDASTableLocMeta &loc_meta,
   return ret;
 }
 
+int ObDASLocationRouter::prefetch(const ObDASTableLocMeta &loc_meta,
+                                  const ObIArray<ObTabletID> &tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  uint64_t tenant_id = MTL_ID();
+  bool is_vt = is_virtual_table(loc_meta.ref_table_id_)
+               && !is_oracle_mapping_real_virtual_table(loc_meta.ref_table_id_);
+  if (is_vt || tablet_ids.count() <= 1) {
+    // virtual table location is not kept in tablet to ls cache
+  } else if (OB_ISNULL(GCTX.location_service_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("location service is null", K(ret));
+  } else if (OB_FAIL(GCTX.location_service_->prefetch(tenant_id,
+                                                      tablet_ids,
+                                                      2 * 1000000 /*same as get()*/))) {
+    LOG_WARN("prefetch ls id failed", K(ret), K(tenant_id), K(loc_meta));
+  }
+  return ret;
+}
+
 int ObDASLocationRouter::get_tablet_loc(const ObDASTableLocMeta &loc_meta,
                                         const ObTabletID &tablet_id,
                                         ObDASTabletLoc &tablet_loc)
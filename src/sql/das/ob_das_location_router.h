@@ -213,6 +213,14 @@ public:
   int get(const ObDASTableLocMeta &loc_meta,
           const common::ObTabletID &tablet_id,
           share::ObLSLocation &location);
+  // is_tablet_cache_hit is false if the tablet to ls mapping was renewed by inner sql
+  int get(const ObDASTableLocMeta &loc_meta,
+          const common::ObTabletID &tablet_id,
+          share::ObLSLocation &location,
+          bool &is_tablet_cache_hit);
+  // resolve the ls of a batch of tablets in one round before get() the rest of them
+  int prefetch(const ObDASTableLocMeta &loc_meta,
+               const common::ObIArray<common::ObTabletID> &tablet_ids);
 
   int get_tablet_loc(const ObDASTableLocMeta &loc_meta,
                      const common::ObTabletID &tablet_id,
@@ -1314,6 +1314,44 @@ int ObBlackFilterExecutor::filter_batch(
             K(result_bitmap.popcnt()));
   return ret;
 }
+// Evaluate the filter on a compacted batch, the i-th datum of the filter columns
+// belongs to the row @row_ids[i] of the micro block.
+int ObBlackFilterExecutor::filter_batch(
+    const int64_t *row_ids,
+    const int64_t row_cnt,
+    common::ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == row_ids || row_cnt <= 0 || row_cnt > op_.get_batch_size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid batch row ids", K(ret), KP(row_ids), K(row_cnt), K(op_.get_batch_size()));
+  } else if (nullptr == skip_bit_) {
+    if (OB_ISNULL(skip_bit_ = to_bit_vector(
+                (char *)(allocator_.alloc(ObBitVector::memory_size(op_.get_batch_size())))))) {
+      ret = common::OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc skip_bit", K(ret));
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    skip_bit_->init(row_cnt);
+    if (OB_FAIL(eval_exprs_batch(*skip_bit_, row_cnt))) {
+      LOG_WARN("failed to eval batch", K(ret));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_cnt; i++) {
+        if (skip_bit_->contain(i)) {
+          continue;
+        } else if (OB_FAIL(result_bitmap.set(row_ids[i]))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(i), K(row_ids[i]));
+        }
+      }
+    }
+    LOG_DEBUG("[PUSHDOWN] microblock black pushdown filter compacted batch row", K(ret),
+              K(row_cnt), K(row_cnt - skip_bit_->accumulate_bit_cnt(row_cnt)),
+              K(result_bitmap.popcnt()));
+  }
+  return ret;
+}
 //--------------------- end filter executor ----------------------------
 
 
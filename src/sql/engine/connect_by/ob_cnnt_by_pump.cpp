@@ -595,7 +595,7 @@ void ObConnectByOpPump::ConnectByHashTable::reverse_bucket_cells()
   }
 }
 
-int ObConnectByOpPump::calc_hash_value(const ObArray<ObExpr *> &hash_exprs, uint64_t &hash_value)
+int ObConnectByOpPump::calc_hash_value(const ObIArray<ObExpr *> &hash_exprs, uint64_t &hash_value)
 {
   int ret = OB_SUCCESS;
   ObDatum *datum = NULL;
@@ -642,7 +642,7 @@ int ObConnectByOpPump::build_hash_table(ObIAllocator &alloc)
     hash_table_.all_cells_->reuse();
   }
   HashTableCell **bucket_end_cell = NULL;
-  const ObArray<ObExpr *> &hash_key_exprs =
+  const ExprFixedArray &hash_key_exprs =
     (static_cast<const ObNLConnectBySpec &>(connect_by_->get_spec())).hash_key_exprs_;
   if (OB_FAIL(ret)) {
   } else if (OB_UNLIKELY(0 == hash_key_exprs.count()) || OB_ISNULL(eval_ctx_)) {
@@ -723,7 +723,7 @@ int ObConnectByOpPump::build_hash_table(ObIAllocator &alloc)
 }
 
 int ObConnectByOpPump::RowFetcher::init(ObConnectByOpPump &connect_by_pump,
-                                        const ObArray<ObExpr *> &hash_probe_exprs)
+                                        const ObIArray<ObExpr *> &hash_probe_exprs)
 {
   int ret = OB_SUCCESS;
   use_hash_ = false;
@@ -121,10 +121,12 @@ class ObNLConnectBySpec : public ObNLConnectBySpecBase
 {
   OB_UNIS_VERSION_V(1);
 public:
-	common::ObArray<ObExpr *> hash_key_exprs_;
-  common::ObArray<ObExpr *> hash_probe_exprs_;
+  // connect by prior的等值条件，右表物化后以hash_key_exprs_建hash表，
+  // 以hash_probe_exprs_探测，需要序列化，否则远程/px执行时会退化为遍历整个row store
+  ExprFixedArray hash_key_exprs_;
+  ExprFixedArray hash_probe_exprs_;
   ObNLConnectBySpec(common::ObIAllocator &alloc, const ObPhyOperatorType type)
-  : ObNLConnectBySpecBase(alloc, type), hash_key_exprs_(), hash_probe_exprs_()
+  : ObNLConnectBySpecBase(alloc, type), hash_key_exprs_(alloc), hash_probe_exprs_(alloc)
   {}
 };
 
@@ -123,12 +123,15 @@ int ObExprJoinFilter::eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx,
             hash_val = hash_func.hash_func_(*datum, hash_val);
           }
         }
-        if (OB_SUCC(ret)) {
-          if (OB_FAIL(bloom_filter_ptr_->might_contain(hash_val, is_match))) {
-            LOG_WARN("fail to check filter might contain value", K(ret), K(hash_val));
-          } else {
-            join_filter_ctx->check_count_++;
-          }
+        if (OB_FAIL(ret)) {
+        } else if (use_key_range(expr, *bloom_filter_ptr_) && !datum->is_null()
+                   && !bloom_filter_ptr_->get_key_range().might_contain(datum->get_int())) {
+          // out of the exact key range of the build side, no need to probe the bits
+          is_match = false;
+        } else if (OB_FAIL(bloom_filter_ptr_->might_contain(hash_val, is_match))) {
+          LOG_WARN("fail to check filter might contain value", K(ret), K(hash_val));
+        } else {
+          join_filter_ctx->check_count_++;
         }
       }
     }
@@ -229,14 +232,24 @@ int ObExprJoinFilter::eval_bloom_filter_batch(
             }
           }
         }
-        if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
+        const bool use_range = OB_SUCC(ret) && use_key_range(expr, *bloom_filter_ptr_);
+        const ObPxBFKeyRange &key_range = bloom_filter_ptr_->get_key_range();
+        const ObDatum *keys = use_range ? expr.args_[0]->locate_batch_datums(ctx) : NULL;
+        const bool is_batch_key = use_range && expr.args_[0]->is_batch_result();
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
               [&](int64_t idx) __attribute__((always_inline)) {
                 bloom_filter_ptr_->prefetch_bits_block(hash_values[idx]); return OB_SUCCESS;
               }))) {
         } else if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
             [&](int64_t idx) __attribute__((always_inline)) {
-              ret = bloom_filter_ptr_->might_contain(hash_values[idx], is_match);
-              ++join_filter_ctx->check_count_;
+              const ObDatum *key = use_range ? &keys[is_batch_key ? idx : 0] : NULL;
+              if (NULL != key && !key->is_null() && !key_range.might_contain(key->get_int())) {
+                is_match = false;
+              } else {
+                ret = bloom_filter_ptr_->might_contain(hash_values[idx], is_match);
+                ++join_filter_ctx->check_count_;
+              }
               ++join_filter_ctx->total_count_;
               join_filter_ctx->filter_count_ += !is_match;
               eval_flags.set(idx);
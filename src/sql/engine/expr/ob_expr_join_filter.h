@@ -56,6 +56,12 @@ public:
   // hard code seed, 32 bit max prime number
   static const int64_t JOIN_FILTER_SEED = 4294967279;
 private:
+  // the key range of the build side only applies to a single integer join key
+  static bool use_key_range(const ObExpr &expr, const ObPxBloomFilter &filter)
+  {
+    return 1 == expr.arg_cnt_ && filter.get_key_range().is_valid()
+           && ObIntTC == ob_obj_type_class(expr.args_[0]->datum_meta_.type_);
+  }
   static const int64_t CHECK_TIMES = 127;
   DISALLOW_COPY_AND_ASSIGN(ObExprJoinFilter);
 };
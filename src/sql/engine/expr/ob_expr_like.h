@@ -153,6 +153,14 @@ public:
   static int like_varchar(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
   static int eval_like_expr_batch_only_text_vectorized(BATCH_EVAL_FUNC_ARG_DECL);
 private:
+  // instr mode matches pattern pieces with memcmp/memmem, which is right only if characters
+  // compare by bytes and a match can never start in the middle of a multi-byte character.
+  // utf8 is self-synchronizing while gbk/gb18030/utf16 are not, so their bin collations are
+  // still matched by wildcmp.
+  OB_INLINE static bool is_instr_mode_supported(const common::ObCollationType cs_type)
+  {
+    return common::CS_TYPE_UTF8MB4_BIN == cs_type || common::CS_TYPE_BINARY == cs_type;
+  }
   static int set_instr_info(common::ObIAllocator *exec_allocator,
                             const common::ObCollationType cs_type,
                             const common::ObString &pattern,
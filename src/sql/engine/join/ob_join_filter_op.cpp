@@ -194,7 +194,8 @@ ObJoinFilterOp::ObJoinFilterOp(ObExecContext &exec_ctx, const ObOpSpec &spec, Ob
     filter_use_(NULL),
     filter_create_(NULL),
     bf_ch_sets_(NULL),
-    batch_hash_values_(NULL)
+    batch_hash_values_(NULL),
+    key_range_()
 {
 }
 
@@ -231,6 +232,9 @@ int ObJoinFilterOp::inner_open()
       ret = OB_NOT_INIT;
       LOG_WARN("the bloom filter is not init", K(ret));
     }
+    if (OB_SUCC(ret) && need_key_range()) {
+      key_range_.set_valid();
+    }
     if (OB_SUCC(ret) && MY_SPEC.max_batch_size_ > 0) {
       if (OB_ISNULL(batch_hash_values_ =
               (uint64_t *)ctx_.get_allocator().alloc(sizeof(uint64_t) * MY_SPEC.max_batch_size_))) {
@@ -278,6 +282,7 @@ int ObJoinFilterOp::do_create_filter_rescan()
     LOG_WARN("filter create is unexpected", K(ret));
   } else {
     filter_create_->reset_filter();
+    key_range_.reuse();
   }
   return ret;
 }
@@ -322,6 +327,7 @@ int ObJoinFilterOp::inner_get_next_row()
         // 说明本 sqc 上的 filter 数据已经收集完毕，可以执行发送。
         // 对于local filter计划, 将filter写入manager
         // 对于shuffle filter计划, 将filter信息写入exec_ctx,由recieve算子发送rpc.
+        filter_create_->merge_key_range(key_range_);
         if (OB_FAIL(filter_input_->check_finish(all_is_finished, MY_SPEC.is_shared_join_filter()))) {
           LOG_WARN("fail to check all worker end", K(ret));
         } else if (all_is_finished && OB_FAIL(send_filter())) {
@@ -412,6 +418,7 @@ int ObJoinFilterOp::inner_get_next_batch(const int64_t max_row_cnt)
   if (OB_SUCC(ret) && brs_.end_) {
     if (MY_SPEC.is_create_mode()) {
       bool all_is_finished = false;
+      filter_create_->merge_key_range(key_range_);
       if (OB_FAIL(filter_input_->check_finish(all_is_finished, MY_SPEC.is_shared_join_filter()))) {
         LOG_WARN("fail to check all worker end", K(ret));
       } else if (all_is_finished && OB_FAIL(send_filter())) {
@@ -579,6 +586,11 @@ int ObJoinFilterOp::insert_by_row()
     /*do nothing*/
   } else if (OB_FAIL(filter_create_->put(hash_value))) {
     LOG_WARN("fail to put  hash value to px bloom filter", K(ret));
+  } else if (key_range_.is_valid()) {
+    const ObDatum &datum = MY_SPEC.join_keys_.at(0)->locate_expr_datum(eval_ctx_);
+    if (!datum.is_null()) {
+      key_range_.add(datum.get_int());
+    }
   }
   return ret;
 }
@@ -635,6 +647,38 @@ int ObJoinFilterOp::insert_by_row_batch(const ObBatchRows *child_brs)
         }
       }
     }
+    if (OB_SUCC(ret) && key_range_.is_valid() && OB_FAIL(add_key_range(child_brs))) {
+      LOG_WARN("fail to add key range", K(ret));
+    }
+  }
+  return ret;
+}
+
+bool ObJoinFilterOp::need_key_range() const
+{
+  return !MY_SPEC.is_partition_filter()
+         && 1 == MY_SPEC.join_keys_.count()
+         && OB_NOT_NULL(MY_SPEC.join_keys_.at(0))
+         && ObIntTC == ob_obj_type_class(MY_SPEC.join_keys_.at(0)->datum_meta_.type_);
+}
+
+int ObJoinFilterOp::add_key_range(const ObBatchRows *child_brs)
+{
+  int ret = OB_SUCCESS;
+  ObExpr *expr = MY_SPEC.join_keys_.at(0);
+  const ObDatum *datums = expr->locate_batch_datums(eval_ctx_);
+  if (!expr->is_batch_result()) {
+    if (!datums[0].is_null()) {
+      key_range_.add(datums[0].get_int());
+    }
+  } else {
+    for (int64_t i = 0; i < child_brs->size_; ++i) {
+      if (child_brs->skip_->at(i) || datums[i].is_null()) {
+        continue;
+      } else {
+        key_range_.add(datums[i].get_int());
+      }
+    }
   }
   return ret;
 }
@@ -155,12 +155,17 @@ private:
   int calc_hash_value(uint64_t &hash_value);
   int do_create_filter_rescan();
   int do_use_filter_rescan();
+  // key range is maintained for a single integer join key only
+  bool need_key_range() const;
+  int add_key_range(const ObBatchRows *child_brs);
 public:
   ObPXBloomFilterHashWrapper bf_key_;
   ObPxBloomFilter *filter_use_;
   ObPxBloomFilter *filter_create_;
   ObPxBloomFilterChSets *bf_ch_sets_;
   uint64_t *batch_hash_values_;
+  // keys put into filter_create_ by this worker, merged into it before sending
+  ObPxBFKeyRange key_range_;
 };
 
 }
@@ -517,6 +517,13 @@ void ObPhysicalPlan::update_plan_stat(const ObAuditRecordData &record,
                                             K(table_row_count_list->at(i)),
                                             "current_elapsed_time", record.get_elapsed_time(),
                                             "plan_stat", stat_);
+              } else if (check_if_card_misestimated(first_exec_row_count,
+                                                    table_row_count_list->at(i))) {
+                set_is_expired(true);
+                LOG_INFO("plan is expired due to cardinality feedback", K(first_exec_row_count),
+                                            K(table_row_count_list->at(i)),
+                                            "current_elapsed_time", record.get_elapsed_time(),
+                                            "plan_stat", stat_);
               }
             }
           } // for max_index end
@@ -649,6 +656,42 @@ inline bool ObPhysicalPlan::check_if_is_expired(const int64_t first_exec_row_cou
   return ret_bool;
 }
 
+/**
+ * 基于基数反馈的计划淘汰：计划按首次执行的参数生成，如果后续某次执行中表扫描实际访问的行数
+ * 与优化器估计的行数相差超过CARD_FEEDBACK_THRESHOLD倍，说明计划是为不同的基数选择的（比如数据倾斜的
+ * 参数值），淘汰计划后用当前参数重新生成。
+ * 如果首次执行时估计就已经不准，重新生成计划也得不到更好的估计，此时不淘汰，避免反复硬解析。
+ * 估计行数是整个扫描（所有分区）的，而反馈的实际行数只来自第一个分区，所以只有单分区扫描才会
+ * 带上估计行数，多分区扫描的est_row_count_为-1，不参与这里的判断。
+ */
+bool ObPhysicalPlan::check_if_card_misestimated(const int64_t first_exec_row_count,
+                                                const ObTableRowCount &current) const
+{
+  bool ret_bool = false;
+  const int64_t est_row_count = current.est_row_count_;
+  const int64_t current_row_count = current.row_count_;
+  if (est_row_count < 0 || first_exec_row_count < 0) {
+    // estimated row count is unknown
+  } else if (!is_card_deviated(est_row_count, first_exec_row_count)) {
+    ret_bool = is_card_deviated(est_row_count, current_row_count);
+  }
+  return ret_bool;
+}
+
+bool ObPhysicalPlan::is_card_deviated(const int64_t est_row_count,
+                                      const int64_t real_row_count) const
+{
+  bool ret_bool = false;
+  const int64_t est = std::max(est_row_count, 1L);
+  const int64_t real = std::max(real_row_count, 1L);
+  if (std::max(est, real) <= EXPIRED_PLAN_TABLE_ROW_THRESHOLD) {
+    ret_bool = false;
+  } else {
+    ret_bool = real / est > CARD_FEEDBACK_THRESHOLD || est / real > CARD_FEEDBACK_THRESHOLD;
+  }
+  return ret_bool;
+}
+
 int ObPhysicalPlan::inc_concurrent_num()
 {
   int ret = OB_SUCCESS;
@@ -1132,6 +1175,7 @@ int ObPhysicalPlan::update_cache_obj_stat(ObILibCacheCtx &ctx)
         for (int64_t i = 0; i < get_access_table_num(); ++i) {
           stat_.table_row_count_first_exec_[i].op_id_ = OB_INVALID_ID;
           stat_.table_row_count_first_exec_[i].row_count_ = -1;
+          stat_.table_row_count_first_exec_[i].est_row_count_ = -1;
         }
       }
     }
@@ -94,6 +94,7 @@ public:
   static const int64_t SLOW_QUERY_SAMPLE_SIZE = 20; // smaller than ObPlanStat::MAX_SCAN_STAT_SIZE
   static const int64_t TABLE_ROW_CHANGE_THRESHOLD = 2;
   static const int64_t EXPIRED_PLAN_TABLE_ROW_THRESHOLD = 100;
+  static const int64_t CARD_FEEDBACK_THRESHOLD = 10;
   OB_UNIS_VERSION(1);
 public:
   explicit ObPhysicalPlan(lib::MemoryContext &mem_context = CURRENT_CONTEXT);
@@ -141,6 +142,9 @@ public:
   bool get_evolution() const { return stat_.is_evolution_; }
   inline bool check_if_is_expired(const int64_t first_exec_row_count,
                                   const int64_t current_row_count) const;
+  bool check_if_card_misestimated(const int64_t first_exec_row_count,
+                                  const ObTableRowCount &current) const;
+  bool is_card_deviated(const int64_t est_row_count, const int64_t real_row_count) const;
 
   bool is_plan_unstable(const int64_t sample_count,
                         const int64_t sample_exec_row_count,
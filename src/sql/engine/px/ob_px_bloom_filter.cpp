@@ -35,9 +35,80 @@ using namespace obrpc;
 #define LOG_HASH_COUNT 2        // = log2(FIXED_HASH_COUNT)
 #define WORD_SIZE 64            // WORD_SIZE * FIXED_HASH_COUNT = BF_BLOCK_SIZE
 
+void ObPxBFKeyRange::add(const int64_t key)
+{
+  min_ = MIN(min_, key);
+  max_ = MAX(max_, key);
+  if (in_count_ >= 0) {
+    bool found = false;
+    for (int64_t i = 0; !found && i < in_count_; ++i) {
+      found = (in_list_[i] == key);
+    }
+    if (found) {
+    } else if (in_count_ < MAX_IN_LIST_COUNT) {
+      in_list_[in_count_++] = key;
+    } else {
+      in_count_ = -1;
+    }
+  }
+}
+
+void ObPxBFKeyRange::merge(const ObPxBFKeyRange &other)
+{
+  if (!other.is_valid_) {
+    // do nothing
+  } else if (!is_valid_) {
+    *this = other;
+  } else {
+    min_ = MIN(min_, other.min_);
+    max_ = MAX(max_, other.max_);
+    if (other.in_count_ < 0) {
+      in_count_ = -1;
+    }
+    for (int64_t i = 0; in_count_ >= 0 && i < other.in_count_; ++i) {
+      add(other.in_list_[i]);
+    }
+  }
+}
+
+OB_DEF_SERIALIZE(ObPxBFKeyRange)
+{
+  int ret = OB_SUCCESS;
+  LST_DO_CODE(OB_UNIS_ENCODE, is_valid_, min_, max_, in_count_);
+  for (int64_t i = 0; OB_SUCC(ret) && i < in_count_; ++i) {
+    OB_UNIS_ENCODE(in_list_[i]);
+  }
+  return ret;
+}
+
+OB_DEF_DESERIALIZE(ObPxBFKeyRange)
+{
+  int ret = OB_SUCCESS;
+  LST_DO_CODE(OB_UNIS_DECODE, is_valid_, min_, max_, in_count_);
+  if (OB_SUCC(ret) && in_count_ > MAX_IN_LIST_COUNT) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected in list count", K(ret), K(in_count_));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < in_count_; ++i) {
+    OB_UNIS_DECODE(in_list_[i]);
+  }
+  return ret;
+}
+
+OB_DEF_SERIALIZE_SIZE(ObPxBFKeyRange)
+{
+  int64_t len = 0;
+  LST_DO_CODE(OB_UNIS_ADD_LEN, is_valid_, min_, max_, in_count_);
+  for (int64_t i = 0; i < in_count_; ++i) {
+    OB_UNIS_ADD_LEN(in_list_[i]);
+  }
+  return len;
+}
+
 ObPxBloomFilter::ObPxBloomFilter() : data_length_(0), bits_count_(0), fpp_(0.0),
     hash_func_count_(0), is_inited_(false), bits_array_length_(0),
-    bits_array_(NULL), true_count_(0), begin_idx_(0), end_idx_(0), allocator_(), lock_(),
+    bits_array_(NULL), true_count_(0), begin_idx_(0), end_idx_(0), key_range_(),
+    allocator_(), lock_(),
     px_bf_recieve_count_(0), px_bf_recieve_size_(0), px_bf_merge_filter_count_(0)
 {
 
@@ -93,12 +164,14 @@ int ObPxBloomFilter::init(ObPxBloomFilter *filter)
     bits_array_ = filter->bits_array_;
     true_count_ = filter->true_count_;
     might_contain_ = filter->might_contain_;
+    key_range_ = filter->key_range_;
   }
   return ret;
 }
 void ObPxBloomFilter::reset_filter()
 {
   MEMSET(bits_array_, 0, bits_array_length_ * sizeof(int64_t));
+  key_range_.reuse();
   px_bf_recieve_count_ = 0;
   px_bf_recieve_size_ = 0;
 }
@@ -203,10 +276,19 @@ int ObPxBloomFilter::merge_filter(ObPxBloomFilter *filter)
         new_v = old_v | filter->bits_array_[i];
       } while(ATOMIC_CAS(&bits_array_[i + filter->begin_idx_], old_v, new_v) != old_v);
     }
+    merge_key_range(filter->key_range_);
   }
   return ret;
 }
 
+void ObPxBloomFilter::merge_key_range(const ObPxBFKeyRange &key_range)
+{
+  if (key_range.is_valid()) {
+    ObSpinLockGuard guard(lock_);
+    key_range_.merge(key_range);
+  }
+}
+
 bool ObPxBloomFilter::check_ready()
 {
   return px_bf_recieve_count_ > 0 &&
@@ -320,6 +402,7 @@ OB_DEF_SERIALIZE(ObPxBloomFilter)
       LOG_WARN("fail to encode bits data", K(ret), K(bits_array_[i]));
     }
   }
+  OB_UNIS_ENCODE(key_range_);
   return ret;
 }
 
@@ -358,6 +441,7 @@ OB_DEF_DESERIALIZE(ObPxBloomFilter)
                        : &ObPxBloomFilter::might_contain_nonsimd;
     }
   }
+  OB_UNIS_DECODE(key_range_);
   return ret;
 }
 
@@ -377,6 +461,7 @@ OB_DEF_SERIALIZE_SIZE(ObPxBloomFilter)
   for (int i = begin_idx_; i <= end_idx_; ++i) {
     len += serialization::encoded_length(bits_array_[i]);
   }
+  OB_UNIS_ADD_LEN(key_range_);
   return len;
 }
 
@@ -52,6 +52,52 @@ struct BloomFilterIndex
   TO_STRING_KV(K_(begin_idx), K_(end_idx));
 };
 
+// Min/max and, while there are few of them, the distinct values of a single integer join
+// key on the build side. Unlike the bits they are exact, the probe side drops keys out of
+// them before probing the bits.
+struct ObPxBFKeyRange
+{
+  OB_UNIS_VERSION(1);
+public:
+  static const int64_t MAX_IN_LIST_COUNT = 16;
+  ObPxBFKeyRange() : is_valid_(false) { reuse(); }
+  void reset() { is_valid_ = false; reuse(); }
+  // keep is_valid_, forget the keys
+  void reuse()
+  {
+    min_ = INT64_MAX;
+    max_ = INT64_MIN;
+    in_count_ = 0;
+  }
+  void set_valid() { is_valid_ = true; }
+  bool is_valid() const { return is_valid_; }
+  bool is_empty() const { return min_ > max_; }
+  void add(const int64_t key);
+  void merge(const ObPxBFKeyRange &other);
+  // return true if there is no key or the key range is not maintained
+  bool might_contain(const int64_t key) const
+  {
+    bool bret = true;
+    if (!is_valid_ || is_empty()) {
+    } else if (key < min_ || key > max_) {
+      bret = false;
+    } else if (in_count_ > 0) {
+      bret = false;
+      for (int64_t i = 0; !bret && i < in_count_; ++i) {
+        bret = (in_list_[i] == key);
+      }
+    }
+    return bret;
+  }
+  TO_STRING_KV(K_(is_valid), K_(min), K_(max), K_(in_count));
+
+  bool is_valid_;
+  int64_t min_;
+  int64_t max_;
+  int64_t in_count_; // -1 once there are more than MAX_IN_LIST_COUNT distinct keys
+  int64_t in_list_[MAX_IN_LIST_COUNT];
+};
+
 class ObPxBloomFilter
 {
 OB_UNIS_VERSION_V(1);
@@ -67,6 +113,8 @@ public:
   int put(uint64_t hash);
   int put_batch(ObPxBFHashArray &hash_val_array);
   int merge_filter(ObPxBloomFilter *filter);
+  void merge_key_range(const ObPxBFKeyRange &key_range);
+  const ObPxBFKeyRange &get_key_range() const { return key_range_; }
   int64_t get_value_true_count() const { return true_count_; };
   void dump_filter();      //for debug
   bool check_ready();
@@ -90,7 +138,7 @@ public:
   int generate_receive_count_array();
   void reset();
   TO_STRING_KV(K_(data_length), K_(bits_count), K_(fpp), K_(hash_func_count), K_(is_inited),
-      K_(bits_array_length), K_(true_count));
+      K_(bits_array_length), K_(true_count), K_(key_range));
 private:
   bool get(uint64_t pos, uint64_t index) { return (bits_array_[pos] & index) != 0; }
   bool set(uint64_t block_begin, uint64_t index);
@@ -111,6 +159,7 @@ private:
   int64_t begin_idx_;            // join filter begin position
   int64_t end_idx_;              // join filter end position
   GetFunc might_contain_;       // function pointer for might contain
+  ObPxBFKeyRange key_range_;     // merged under lock_
 private:
   common::ObArenaAllocator allocator_;
   mutable common::ObSpinLock lock_;
@@ -53,7 +53,9 @@ ObSubQueryIterator::ObSubQueryIterator(ObOperator &op)
     iter_brs_(NULL),
     batch_size_(0),
     batch_row_pos_(0),
-    iter_end_(false)
+    iter_end_(false),
+    das_batch_group_idx_(-1),
+    das_batch_group_touched_(false)
 {
 }
 
@@ -81,6 +83,10 @@ int ObSubQueryIterator::rewind(const bool reset_onetime_plan /* = false */)
     if (OB_FAIL(store_.begin(store_it_))) {
       LOG_WARN("failed to rewind iterator", K(ret));
     }
+  } else if (OB_NOT_NULL(parent_) && parent_->enable_das_batch_rescan()) {
+    if (OB_FAIL(das_batch_rewind())) {
+      LOG_WARN("failed to do das batch rewind", K(ret));
+    }
   } else {
     if (OB_FAIL(op_.rescan())) {
       LOG_WARN("failed to do rescan", K(ret));
@@ -95,6 +101,41 @@ int ObSubQueryIterator::rewind(const bool reset_onetime_plan /* = false */)
   return ret;
 }
 
+// The das group scan below returns the rows of each left row of the group in order, every
+// rescan with plain params switches to the next left row. Left rows may not rewind the
+// iterator at all (hash map hit, short-circuited expr), so skip to the group of current left
+// row here; rewinding a left row twice scans the whole group again.
+int ObSubQueryIterator::das_batch_rewind()
+{
+  int ret = OB_SUCCESS;
+  const int64_t group_idx = parent_->get_batch_rescan_ctl().cur_idx_;
+  if (das_batch_group_idx_ < 0
+      || group_idx < das_batch_group_idx_
+      || (group_idx == das_batch_group_idx_ && das_batch_group_touched_)) {
+    das_batch_group_idx_ = -1;
+    if (OB_FAIL(parent_->bind_das_batch_params())) {
+      LOG_WARN("failed to bind das batch params", K(ret));
+    } else if (OB_FAIL(op_.rescan())) {
+      LOG_WARN("failed to do rescan", K(ret));
+    } else if (OB_FAIL(parent_->restore_cur_row_params())) {
+      LOG_WARN("failed to restore current row params", K(ret));
+    } else {
+      das_batch_group_idx_ = 0;
+    }
+  }
+  while (OB_SUCC(ret) && das_batch_group_idx_ < group_idx) {
+    if (OB_FAIL(op_.rescan())) {
+      LOG_WARN("failed to switch to next group", K(ret), K(das_batch_group_idx_), K(group_idx));
+    } else {
+      das_batch_group_idx_++;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    das_batch_group_touched_ = true;
+  }
+  return ret;
+}
+
 void ObSubQueryIterator::reuse()
 {
   inited_ = false;
@@ -311,7 +352,9 @@ ObSubPlanFilterOp::ObSubPlanFilterOp(
     cur_params_(),
     cur_param_idxs_(),
     cur_param_expr_idxs_(),
-    last_store_row_mem_(NULL)
+    last_store_row_mem_(NULL),
+    das_batch_params_(),
+    das_batch_params_capacity_(0)
 {
 }
 
@@ -366,7 +409,7 @@ int ObSubPlanFilterOp::rescan()
     LOG_WARN("failed to inner rescan", K(ret));
   }
 
-  if (OB_SUCC(ret) && enable_left_px_batch_) {
+  if (OB_SUCC(ret) && enable_left_group_rescan()) {
     left_rows_.reset();
     left_rows_iter_.reset();
     batch_rescan_ctl_.reuse();
@@ -380,7 +423,12 @@ int ObSubPlanFilterOp::rescan()
   }
 
   for (int32_t i = 1; OB_SUCC(ret) && i < child_cnt_; ++i) {
-    if (OB_FAIL(children_[i]->rescan())) {
+    if (enable_left_das_batch_
+        && !MY_SPEC.init_plan_idxs_.has_member(i)
+        && !MY_SPEC.one_time_idxs_.has_member(i)) {
+      // rescanned with the params of the first group of left rows on rewind
+      subplan_iters_.at(i - 1)->reset_das_batch();
+    } else if (OB_FAIL(children_[i]->rescan())) {
       LOG_WARN("rescan child operator failed", K(ret),
                "op", op_name(), "child", children_[i]->op_name());
     }
@@ -495,7 +543,6 @@ int ObSubPlanFilterOp::inner_open()
             MY_SPEC.enable_px_batch_rescans_.at(i)) {
           enable_left_px_batch_ = true;
         }
-        enable_left_das_batch_ = MY_SPEC.enable_das_batch_rescans_;
         if (!MY_SPEC.exec_param_idxs_inited_) {
           //unittest or old version, do not init hashmap
         } else if (OB_FAIL(iter->init_mem_entity())) {
@@ -514,7 +561,11 @@ int ObSubPlanFilterOp::inner_open()
       }
     }
   }
-  if (enable_left_px_batch_ && OB_ISNULL(last_store_row_mem_)) {
+  if (OB_SUCC(ret)) {
+    // px batch rescan drives remote children, das batch rescan is only for local das scans
+    enable_left_das_batch_ = MY_SPEC.enable_das_batch_rescans_ && !enable_left_px_batch_;
+  }
+  if (OB_SUCC(ret) && enable_left_group_rescan() && OB_ISNULL(last_store_row_mem_)) {
     ObSQLSessionInfo *session = ctx_.get_my_session();
     uint64_t tenant_id =session->get_effective_tenant_id();
     lib::ContextParam param;
@@ -533,6 +584,9 @@ int ObSubPlanFilterOp::inner_open()
       left_rows_.set_allocator(last_store_row_mem_->get_malloc_allocator());
     }
   }
+  if (OB_SUCC(ret) && enable_left_das_batch_ && OB_FAIL(init_das_batch_params())) {
+    LOG_WARN("init das batch params failed", K(ret));
+  }
   if (OB_SUCC(ret) && is_vectorized()) {
     if (OB_FAIL(brs_holder_.init(child_->get_spec().output_, eval_ctx_))) {
       LOG_WARN("init brs_holder_ failed", K(ret));
@@ -541,6 +595,106 @@ int ObSubPlanFilterOp::inner_open()
   return ret;
 }
 
+int ObSubPlanFilterOp::init_das_batch_params()
+{
+  int ret = OB_SUCCESS;
+  // vectorized left child may overshoot the group size by one batch
+  das_batch_params_capacity_ = left_group_size() + MY_SPEC.max_batch_size_;
+  if (!das_batch_params_.empty()) {
+    // allocated by previous open
+  } else if (OB_FAIL(das_batch_params_.allocate_array(ctx_.get_allocator(),
+                                                      MY_SPEC.rescan_params_.count()))) {
+    LOG_WARN("allocate das batch params failed", K(ret), K(MY_SPEC.rescan_params_.count()));
+  } else {
+    const int64_t obj_buf_size = sizeof(ObObjParam) * das_batch_params_capacity_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < das_batch_params_.count(); ++i) {
+      ObExpr *dst_expr = MY_SPEC.rescan_params_.at(i).dst_;
+      void *buf = ctx_.get_allocator().alloc(obj_buf_size);
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to alloc memory", K(ret), K(obj_buf_size));
+      } else {
+        das_batch_params_.at(i).data_ = reinterpret_cast<ObObjParam*>(buf);
+        das_batch_params_.at(i).count_ = 0;
+        das_batch_params_.at(i).element_.set_meta_type(dst_expr->obj_meta_);
+      }
+    }
+  }
+  return ret;
+}
+
+// params of left rows are deep copied into batch_rescan_ctl_ while materializing the group,
+// share them with the das group scan.
+int ObSubPlanFilterOp::fill_das_batch_params()
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = batch_rescan_ctl_.params_.get_count();
+  if (OB_UNLIKELY(row_cnt > das_batch_params_capacity_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("too many left rows for das batch rescan", K(ret), K(row_cnt),
+             K(das_batch_params_capacity_));
+  }
+  for (int64_t row_idx = 0; OB_SUCC(ret) && row_idx < row_cnt; ++row_idx) {
+    common::ObIArray<common::ObObjParam> &params =
+        batch_rescan_ctl_.params_.get_one_batch_params(row_idx);
+    if (OB_UNLIKELY(params.count() != das_batch_params_.count())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("param count mismatch", K(ret), K(params.count()), K(das_batch_params_.count()));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < params.count(); ++i) {
+      das_batch_params_.at(i).data_[row_idx] = params.at(i);
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < das_batch_params_.count(); ++i) {
+    das_batch_params_.at(i).count_ = row_cnt;
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < subplan_iters_.count(); ++i) {
+    subplan_iters_.at(i)->reset_das_batch();
+  }
+  return ret;
+}
+
+int ObSubPlanFilterOp::bind_das_batch_params()
+{
+  int ret = OB_SUCCESS;
+  ParamStore &param_store = GET_PHY_PLAN_CTX(ctx_)->get_param_store_for_update();
+  if (OB_UNLIKELY(MY_SPEC.rescan_params_.count() != das_batch_params_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("das batch param count is invalid", K(ret), K(MY_SPEC.rescan_params_.count()),
+             K(das_batch_params_.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < das_batch_params_.count(); ++i) {
+    const int64_t param_idx = MY_SPEC.rescan_params_.at(i).param_idx_;
+    const int64_t array_obj_addr = reinterpret_cast<int64_t>(&das_batch_params_.at(i));
+    param_store.at(param_idx).set_extend(array_obj_addr, T_EXT_SQL_ARRAY);
+  }
+  return ret;
+}
+
+int ObSubPlanFilterOp::restore_cur_row_params()
+{
+  int ret = OB_SUCCESS;
+  ParamStore &param_store = GET_PHY_PLAN_CTX(ctx_)->get_param_store_for_update();
+  const int64_t row_idx = batch_rescan_ctl_.cur_idx_;
+  if (OB_UNLIKELY(das_batch_params_.empty() || row_idx >= das_batch_params_.at(0).count_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("row idx is unexpected", K(ret), K(row_idx));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < das_batch_params_.count(); ++i) {
+    const ObDynamicParamSetter &rescan_param = MY_SPEC.rescan_params_.at(i);
+    ObExpr *dst = rescan_param.dst_;
+    ObDatum &param_datum = dst->locate_datum_for_write(eval_ctx_);
+    const ObObjParam &obj = das_batch_params_.at(i).data_[row_idx];
+    if (OB_FAIL(param_datum.from_obj(obj, dst->obj_datum_map_))) {
+      LOG_WARN("fail to cast datum", K(ret));
+    } else {
+      param_store.at(rescan_param.param_idx_) = obj;
+      dst->set_evaluated_projected(eval_ctx_);
+    }
+  }
+  return ret;
+}
+
 int ObSubPlanFilterOp::inner_close()
 {
   destroy_subplan_iters();
@@ -575,9 +729,9 @@ int ObSubPlanFilterOp::handle_next_row()
     OZ(prepare_onetime_exprs());
   }
   if (OB_FAIL(ret)) {
-  } else if (enable_left_px_batch_) {
+  } else if (enable_left_group_rescan()) {
     bool has_row = false;
-    int batch_count = PX_RESCAN_BATCH_ROW_COUNT;
+    int64_t batch_count = left_group_size();
     if (left_rows_iter_.is_valid() && left_rows_iter_.has_next()) {
       batch_rescan_ctl_.cur_idx_++;
     } else if (is_left_end_) {
@@ -633,6 +787,9 @@ int ObSubPlanFilterOp::handle_next_row()
         ret = OB_SUCCESS;
         OZ(left_rows_.finish_add_row(false));
         OZ(left_rows_.begin(left_rows_iter_));
+        if (OB_SUCC(ret) && enable_left_das_batch_ && OB_FAIL(fill_das_batch_params())) {
+          LOG_WARN("fill das batch params failed", K(ret));
+        }
       }
     }
     if (OB_SUCC(ret)) {
@@ -717,9 +874,12 @@ int ObSubPlanFilterOp::handle_next_batch_with_px_rescan(const int64_t op_max_bat
       } else if (OB_FAIL(left_rows_.begin(left_rows_iter_))) {
         LOG_WARN("prepare rescan params failed", K(ret));
       }
-      if (left_rows_total_cnt != left_rows_.get_row_cnt()) {
+      if (OB_FAIL(ret)) {
+      } else if (left_rows_total_cnt != left_rows_.get_row_cnt()) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("left_rows row cnt is unexpectd", K(ret));
+      } else if (enable_left_das_batch_ && OB_FAIL(fill_das_batch_params())) {
+        LOG_WARN("fill das batch params failed", K(ret));
       }
     }
   }
@@ -799,7 +959,7 @@ int ObSubPlanFilterOp::inner_get_next_batch(const int64_t max_row_cnt)
   }
   //从主表中获取一行数据
   clear_evaluated_flag();
-  if (enable_left_px_batch_) {
+  if (enable_left_group_rescan()) {
     if (OB_FAIL(handle_next_batch_with_px_rescan(op_max_batch_size))) {
       LOG_WARN("handle_next_batch_with_px_rescan failed", K(ret));
     }
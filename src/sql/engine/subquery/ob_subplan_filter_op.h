@@ -60,6 +60,12 @@ public:
   int get_next_row();
 
   int prepare_init_plan();
+  // forget the group fetched by das batch rescan, the next rewind scans the new group
+  void reset_das_batch()
+  {
+    das_batch_group_idx_ = -1;
+    das_batch_group_touched_ = false;
+  }
   void reuse();
   int rewind(bool reset_onetime_plan = false);
   //int rescan_chlid(int64_t child_idx);
@@ -79,7 +85,7 @@ public:
   int get_refactored(common::ObDatum &out);
   //set row into hashmap
   int set_refactored(const DatumRow &row, const ObDatum &result, const int64_t deep_copy_size);
-  void set_parent(const ObSubPlanFilterOp *filter) { parent_ = filter; }
+  void set_parent(ObSubPlanFilterOp *filter) { parent_ = filter; }
   int reset_hash_map();
 
   bool check_can_insert(const int64_t deep_copy_size)
@@ -93,7 +99,7 @@ public:
   int get_next_batch(const int64_t max_row_cnt, const ObBatchRows *&batch_rows);
   //for vectorized end
   bool is_onetime_plan() const { return onetime_plan_; }
-  TO_STRING_KV(K(onetime_plan_), K(init_plan_), K(inited_));
+  TO_STRING_KV(K(onetime_plan_), K(init_plan_), K(inited_), K(das_batch_group_idx_));
 
   //a row cache for hash optimizer to use
   DatumRow probe_row_;
@@ -101,6 +107,7 @@ public:
   const static int HASH_MAP_MEMORY_LIMIT = 1024 * 1024;
 
 private:
+  int das_batch_rewind();
 
   ObOperator &op_;
   bool onetime_plan_;
@@ -114,7 +121,7 @@ private:
   common::hash::ObHashMap<DatumRow, common::ObDatum, common::hash::NoPthreadDefendMode> hashmap_;
   lib::MemoryContext mem_entity_;
   int64_t id_; // curr op_id in spf
-  const ObSubPlanFilterOp *parent_; //needs to get exec_param_idxs_ from op
+  ObSubPlanFilterOp *parent_; //needs to get exec_param_idxs_ from op
   int64_t memory_used_;
   ObEvalCtx &eval_ctx_;
 
@@ -124,6 +131,11 @@ private:
   int64_t batch_row_pos_;
   bool iter_end_;
   // for vectorized end
+
+  // for das batch rescan, the group of left rows the child is positioned at (-1 if the
+  // group is not fetched yet) and whether the rows of that group have been handed out.
+  int64_t das_batch_group_idx_;
+  bool das_batch_group_touched_;
 };
 
 class ObSubPlanFilterSpec : public ObOpSpec
@@ -182,6 +194,8 @@ public:
   int handle_next_row();
   bool enable_px_batch_rescan() { return enable_left_px_batch_; }
   bool enable_das_batch_rescan() { return enable_left_das_batch_; }
+  // left rows are materialized in groups, for either px or das batch rescan
+  bool enable_left_group_rescan() const { return enable_left_px_batch_ || enable_left_das_batch_; }
   //for vectorized
   int inner_get_next_batch(const int64_t max_row_cnt);
   // for vectorized end
@@ -192,6 +206,11 @@ public:
   ObBatchRescanCtl &get_batch_rescan_ctl() { return batch_rescan_ctl_; }
   static const int64_t PX_RESCAN_BATCH_ROW_COUNT = 8192;
   int handle_next_batch_with_px_rescan(const int64_t op_max_batch_size);
+  // bind the params of the whole group of left rows as sql arrays, so that the das group
+  // scan fetches the results of all rows in one rescan
+  int bind_das_batch_params();
+  // set the params of current left row back after bind_das_batch_params()
+  int restore_cur_row_params();
 private:
   void set_param_null() { set_pushdown_param_null(MY_SPEC.rescan_params_); };
   void destroy_subplan_iters();
@@ -210,8 +229,15 @@ private:
   int handle_update_set();
   bool continue_fetching(uint64_t left_rows_total_cnt, bool stop)
   {
-    return (!stop && (left_rows_total_cnt < PX_RESCAN_BATCH_ROW_COUNT));
+    return (!stop && (left_rows_total_cnt < left_group_size()));
+  }
+  // das group scan is limited to BNLJ_DEFAULT_GROUP_SIZE (plus one batch) groups
+  uint64_t left_group_size() const
+  {
+    return enable_left_px_batch_ ? PX_RESCAN_BATCH_ROW_COUNT : BNLJ_DEFAULT_GROUP_SIZE;
   }
+  int init_das_batch_params();
+  int fill_das_batch_params();
 
 private:
   common::ObSEArray<Iterator *, 16> subplan_iters_;
@@ -235,6 +261,9 @@ private:
   common::ObSEArray<Iterator*, 8> subplan_iters_to_check_;
   lib::MemoryContext last_store_row_mem_;
   ObBatchResultHolder brs_holder_;
+  // for das batch rescan, params of the current group of left rows
+  common::ObArrayWrap<ObSqlArrayObj> das_batch_params_;
+  int64_t das_batch_params_capacity_;
 };
 
 } // end namespace sql
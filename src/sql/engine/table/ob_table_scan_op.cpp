@@ -378,7 +378,8 @@ OB_SERIALIZE_MEMBER((ObTableScanSpec, ObOpSpec),
                     tsc_ctdef_,
                     pdml_partition_id_,
                     agent_vt_meta_,
-                    ddl_output_cids_);
+                    ddl_output_cids_,
+                    phy_query_range_row_count_);
 
 DEF_TO_STRING(ObTableScanSpec)
 {
@@ -1279,6 +1280,12 @@ int ObTableScanOp::fill_storage_feedback_info()
   // 填充计划淘汰策略所需要的反馈信息
   ObIArray<ObTableRowCount> &table_row_count_list =
       GET_PHY_PLAN_CTX(ctx_)->get_table_row_count_list();
+  // phy_query_range_row_count_ is estimated for all partitions of the scan while the row count
+  // below comes from the first das task only, so the estimate is reported for single tablet
+  // scans only, see ObPhysicalPlan::check_if_card_misestimated
+  const ObDASTableLoc *table_loc = tsc_rtdef_.scan_rtdef_.table_loc_;
+  const int64_t est_row_count = (OB_NOT_NULL(table_loc) && 1 == table_loc->get_tablet_locs().size())
+                                ? MY_SPEC.phy_query_range_row_count_ : -1;
   //仅索引回表时，存储层会将执行扫描索引数据放在idx_table_scan_stat_中;
   //对于仅扫描主表或索引表的情况, 存储层会将执行扫描索引数据放在main_table_scan_stat_中
   if (!got_feedback_) {
@@ -1287,7 +1294,8 @@ int ObTableScanOp::fill_storage_feedback_info()
       if (scan_param.scan_flag_.is_need_feedback()) {
         int tmp_ret = OB_SUCCESS;
         if (OB_SUCCESS != (tmp_ret = table_row_count_list.push_back(ObTableRowCount(
-                                                                      MY_SPEC.id_, scan_param.idx_table_scan_stat_.access_row_cnt_)))) {
+                                                                      MY_SPEC.id_, scan_param.idx_table_scan_stat_.access_row_cnt_,
+                                                                      est_row_count)))) {
           // 这里忽略插入失败时的错误码. OB的Array保证push_back失败的情况下count()仍是有效的
           // 如果一张表的信息没有被插入成功，最多
           // 只会导致后续判断计划能否淘汰时无法使用这张表的信息进行判断，从而
@@ -1301,7 +1309,8 @@ int ObTableScanOp::fill_storage_feedback_info()
       if (scan_param.scan_flag_.is_need_feedback()) {
         int tmp_ret = OB_SUCCESS;
         if (OB_SUCCESS != (tmp_ret = table_row_count_list.push_back(ObTableRowCount(
-                                                                      MY_SPEC.id_, scan_param.main_table_scan_stat_.access_row_cnt_)))) {
+                                                                      MY_SPEC.id_, scan_param.main_table_scan_stat_.access_row_cnt_,
+                                                                      est_row_count)))) {
           LOG_WARN("push back table_id-row_count failed but we won't stop execution", K(tmp_ret));
         }
       }
@@ -317,6 +317,108 @@ DEF_TO_STRING(ObWindowFunctionOp::AggrCell)
   return pos;
 }
 
+void ObWindowFunctionOp::ExtremumDeque::init(const bool is_max,
+                                             const ObDatumCmpFuncType cmp_func,
+                                             const uint64_t tenant_id)
+{
+  is_max_ = is_max;
+  cmp_func_ = cmp_func;
+  items_.set_label("WfExtremumDq");
+  for (int64_t i = 0; i < 2; i++) {
+    allocs_[i].set_tenant_id(tenant_id);
+    allocs_[i].set_label("WfExtremumDq");
+    allocs_[i].set_ctx_id(ObCtxIds::WORK_AREA);
+  }
+}
+
+void ObWindowFunctionOp::ExtremumDeque::destroy()
+{
+  items_.reset();
+  allocs_[0].reset();
+  allocs_[1].reset();
+  head_ = 0;
+  live_size_ = 0;
+}
+
+void ObWindowFunctionOp::ExtremumDeque::reuse()
+{
+  items_.reuse();
+  allocs_[cur_alloc_].reuse();
+  head_ = 0;
+  live_size_ = 0;
+}
+
+int ObWindowFunctionOp::ExtremumDeque::push(const int64_t idx, const ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(cmp_func_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("cmp func is null", K(ret));
+  } else if (val.is_null()) {
+    // null is ignored by MIN/MAX
+  } else {
+    bool dominated = true;
+    while (dominated && !empty()) {
+      const ObDatum &back = items_.at(items_.count() - 1).val_;
+      const int cmp = cmp_func_(back, val);
+      // keep the earlier one of equal values, it leaves the frame first anyway
+      dominated = is_max_ ? cmp < 0 : cmp > 0;
+      if (dominated) {
+        live_size_ -= back.len_;
+        items_.pop_back();
+      }
+    }
+    if (empty()) {
+      reuse();
+    } else if (need_compact() && OB_FAIL(compact())) {
+      LOG_WARN("compact extremum deque failed", K(ret));
+    }
+    Item item;
+    item.idx_ = idx;
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(item.val_.deep_copy(val, allocs_[cur_alloc_]))) {
+      LOG_WARN("deep copy datum failed", K(ret));
+    } else if (OB_FAIL(items_.push_back(item))) {
+      LOG_WARN("push back failed", K(ret));
+    } else {
+      live_size_ += val.len_;
+    }
+  }
+  return ret;
+}
+
+void ObWindowFunctionOp::ExtremumDeque::pop_before(const int64_t idx)
+{
+  while (!empty() && items_.at(head_).idx_ < idx) {
+    live_size_ -= items_.at(head_).val_.len_;
+    head_++;
+  }
+}
+
+int ObWindowFunctionOp::ExtremumDeque::compact()
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator &alloc = allocs_[1 - cur_alloc_];
+  alloc.reuse();
+  const int64_t cnt = items_.count() - head_;
+  for (int64_t i = 0; OB_SUCC(ret) && i < cnt; i++) {
+    Item &item = items_.at(i + head_);
+    items_.at(i).idx_ = item.idx_;
+    if (OB_FAIL(items_.at(i).val_.deep_copy(item.val_, alloc))) {
+      LOG_WARN("deep copy datum failed", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    while (items_.count() > cnt) {
+      items_.pop_back();
+    }
+    allocs_[cur_alloc_].reuse();
+    cur_alloc_ = 1 - cur_alloc_;
+    head_ = 0;
+  }
+  return ret;
+}
+
 template <typename OP>
 int ObWindowFunctionOp::foreach_stores(OP op)
 {
@@ -1104,6 +1206,12 @@ int ObWindowFunctionOp::init()
               } else {
                 aggr_func->aggr_processor_.set_dir_id(dir_id_);
                 aggr_func->aggr_processor_.set_io_event_observer(&io_event_observer_);
+                if ((T_FUN_MAX == wf_info.func_type_ || T_FUN_MIN == wf_info.func_type_)
+                    && 1 == wf_info.aggr_info_.param_exprs_.count()) {
+                  aggr_func->use_extremum_deque_ = true;
+                  aggr_func->extremum_deque_.init(T_FUN_MAX == wf_info.func_type_,
+                      wf_info.aggr_info_.expr_->basic_funcs_->null_first_cmp_, tenant_id);
+                }
                 wf_cell = aggr_func;
               }
             }
@@ -1406,7 +1514,14 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
               K(row_idx), K(upper_has_null), K(lower_has_null), K(wf_cell));
     if (!upper_has_null && !lower_has_null && Frame::valid_frame(part_frame, new_frame)) {
       Frame::prune_frame(part_frame, new_frame);
-      if (wf_cell.is_aggr()) {
+      if (wf_cell.is_aggr() && static_cast<AggrCell &>(wf_cell).use_extremum_deque_) {
+        if (OB_FAIL(compute_sliding_extremum(row_reader, static_cast<AggrCell &>(wf_cell),
+                                             new_frame, val))) {
+          LOG_WARN("compute sliding extremum failed", K(ret), K(new_frame));
+        } else {
+          last_valid_frame = new_frame;
+        }
+      } else if (wf_cell.is_aggr()) {
         AggrCell *aggr_func = static_cast<AggrCell *>(&wf_cell);
         const ObRADatumStore::StoredRow *cur_row = NULL;
         if (!Frame::same_frame(last_valid_frame, new_frame)) {
@@ -1529,6 +1644,55 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
   return ret;
 }
 
+// MIN/MAX over a frame which slides forward: append rows entering the frame to the monotonic
+// deque and drop rows leaving it, instead of restarting the aggregation whenever the extremum
+// slides out. Frames moving backward or jumping past the last one rebuild the deque.
+// %val points into the deque and is valid until next compute.
+int ObWindowFunctionOp::compute_sliding_extremum(RowsReader &row_reader,
+                                                 AggrCell &aggr_func,
+                                                 const Frame &new_frame,
+                                                 ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  const Frame &last_valid_frame = aggr_func.last_valid_frame_;
+  ExtremumDeque &deque = aggr_func.extremum_deque_;
+  ObExpr *param = aggr_func.wf_info_.aggr_info_.param_exprs_.at(0);
+  int64_t begin = new_frame.head_;
+  if (-1 == last_valid_frame.head_ || -1 == last_valid_frame.tail_
+      || new_frame.head_ < last_valid_frame.head_
+      || new_frame.tail_ < last_valid_frame.tail_
+      || new_frame.head_ > last_valid_frame.tail_) {
+    deque.reuse();
+  } else {
+    begin = last_valid_frame.tail_ + 1;
+  }
+  const ObRADatumStore::StoredRow *cur_row = NULL;
+  ObDatum *param_val = NULL;
+  for (int64_t i = begin; OB_SUCC(ret) && i <= new_frame.tail_; ++i) {
+    if (OB_FAIL(row_reader.get_row(i, cur_row))) {
+      LOG_WARN("get cur row failed", K(ret), K(i));
+    } else if (FALSE_IT(clear_evaluated_flag())) {
+    } else if (OB_FAIL(cur_row->to_expr(get_all_expr(), eval_ctx_))) {
+      LOG_WARN("Failed to to_expr", K(ret));
+    } else if (OB_FAIL(param->eval(eval_ctx_, param_val))) {
+      LOG_WARN("eval aggr param failed", K(ret));
+    } else if (OB_FAIL(deque.push(i, *param_val))) {
+      LOG_WARN("push extremum deque failed", K(ret), K(i), K(deque));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    deque.pop_before(new_frame.head_);
+    if (deque.empty()) {
+      val.set_null();
+    } else {
+      val = deque.front();
+    }
+    LOG_DEBUG("finish compute sliding extremum", K(last_valid_frame), K(new_frame), K(deque),
+              K(val));
+  }
+  return ret;
+}
+
 int ObWindowFunctionOp::inner_get_next_row()
 {
   int ret = OB_SUCCESS;
@@ -441,6 +441,59 @@ public:
     Frame last_valid_frame_;
   };
 
+  // Monotonic deque of the non-null param values of MIN/MAX in a sliding frame, values are
+  // kept in frame order and strictly "worse" from front to back, so the front is the extremum.
+  // While frame head and tail only move forward every row is pushed and popped at most once,
+  // a partition is computed in O(n) instead of restarting the aggregation whenever the
+  // extremum slides out, which is O(n * frame) for monotonic input.
+  class ExtremumDeque
+  {
+  public:
+    struct Item
+    {
+      Item() : idx_(-1), val_() {}
+      TO_STRING_KV(K_(idx), K_(val));
+      int64_t idx_;
+      ObDatum val_;
+    };
+    ExtremumDeque()
+      : is_max_(true), cmp_func_(NULL), head_(0), items_(), cur_alloc_(0), live_size_(0)
+    {}
+    ~ExtremumDeque() { destroy(); }
+    void init(const bool is_max, const common::ObDatumCmpFuncType cmp_func,
+              const uint64_t tenant_id);
+    void destroy();
+    void reuse();
+    // pop values dominated by %val from the back, then append it
+    int push(const int64_t idx, const ObDatum &val);
+    // pop values of rows before %idx from the front
+    void pop_before(const int64_t idx);
+    bool empty() const { return head_ >= items_.count(); }
+    const ObDatum &front() const { return items_.at(head_).val_; }
+    TO_STRING_KV(K_(is_max), K_(head), "count", items_.count(), K_(cur_alloc), K_(live_size));
+  private:
+    // most of the item array or the value memory is held by popped values
+    bool need_compact() const
+    {
+      const int64_t used = allocs_[cur_alloc_].used();
+      return (head_ > COMPACT_ITEM_THRESHOLD && head_ * 2 > items_.count())
+          || (used > COMPACT_MEM_THRESHOLD && used > 2 * live_size_);
+    }
+    int compact();
+  private:
+    static const int64_t COMPACT_ITEM_THRESHOLD = 1024;
+    static const int64_t COMPACT_MEM_THRESHOLD = 64L << 10;
+    bool is_max_;
+    common::ObDatumCmpFuncType cmp_func_;
+    int64_t head_;
+    common::ObArray<Item> items_;
+    // values are deep copied into allocs_[cur_alloc_], live ones are moved to the other
+    // allocator once most of the memory is held by popped values.
+    common::ObArenaAllocator allocs_[2];
+    int64_t cur_alloc_;
+    int64_t live_size_;
+  };
+
   class AggrCell : public WinFuncCell
   {
   public:
@@ -450,7 +503,9 @@ public:
         aggr_processor_(op_.eval_ctx_, aggr_infos, "WindowAggProc"),
         result_(),
         got_result_(false),
-        remove_type_(wf_info.remove_type_)
+        remove_type_(wf_info.remove_type_),
+        use_extremum_deque_(false),
+        extremum_deque_()
     {}
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
@@ -487,6 +542,7 @@ public:
       aggr_processor_.reuse();
       result_.reset();
       got_result_ = false;
+      extremum_deque_.reuse();
     }
   public:
     bool finish_prepared_;
@@ -494,6 +550,9 @@ public:
     ObDatum result_;
     bool got_result_;
     uint64_t remove_type_;
+    // MIN/MAX evaluated by sliding extremum_deque_ instead of aggr_processor_
+    bool use_extremum_deque_;
+    ExtremumDeque extremum_deque_;
   };
 
   class NonAggrCell : public WinFuncCell
@@ -691,6 +750,8 @@ protected:
   int input_one_row(WinFuncCell &func_ctx, bool &part_end);
   int compute(RowsReader &row_reader, WinFuncCell &wf_cell, const int64_t row_idx,
               common::ObDatum &val);
+  int compute_sliding_extremum(RowsReader &row_reader, AggrCell &aggr_func,
+                               const Frame &new_frame, common::ObDatum &val);
   int check_same_partition(const ExprFixedArray &other_exprs,
                            bool &is_same_part,
                            const ExprFixedArray *curr_exprs = NULL);
@@ -10893,7 +10893,7 @@ int ObLogPlan::adjust_final_plan_info(ObLogicalOperator *&op)
       } else if (log_op_def::LOG_JOIN == op->get_type() &&
                  OB_FAIL(static_cast<ObLogJoin*>(op)->set_use_batch(op->get_child(1)))) {
         LOG_WARN("failed to set use batch nlj", K(ret));
-      } else if (log_op_def::LOG_SUBPLAN_FILTER == op->get_type() && false && // TODO: chenxuan open it
+      } else if (log_op_def::LOG_SUBPLAN_FILTER == op->get_type() &&
                  OB_FAIL(static_cast<ObLogSubPlanFilter*>(op)->check_and_set_use_batch())) {
         LOG_WARN("failed to set use batch spf", K(ret));
       } else { /*do nothing*/ }
@@ -464,6 +464,20 @@ int ObLogSubPlanFilter::check_if_match_das_batch_rescan(ObLogicalOperator *root,
       LOG_WARN("failed to check query range contribution", K(ret));
     } else if (is_valid) {
       enable_das_batch_rescans = true;
+      // the das group scan only rebinds exec params of the query range,
+      // filters with exec params would be evaluated against stale values
+      const ObIArray<ObRawExpr*> &filters = tsc->get_filter_exprs();
+      for (int64_t i = 0; OB_SUCC(ret) && enable_das_batch_rescans && i < filters.count(); ++i) {
+        const ObRawExpr *expr = filters.at(i);
+        if (OB_ISNULL(expr)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("table filter is null", K(ret));
+        } else if (ObOptimizerUtil::find_item(tsc->get_range_conditions(), expr)) {
+          // range expr, do nothing
+        } else {
+          enable_das_batch_rescans = !expr->has_flag(CNT_DYNAMIC_PARAM);
+        }
+      }
     }
   } else if (root->get_num_of_child() == 1 &&
              OB_FAIL(SMART_CALL(check_if_match_das_batch_rescan(root->get_child(0),
@@ -518,7 +532,13 @@ int ObLogSubPlanFilter::check_and_set_use_batch()
 {
   int ret = OB_SUCCESS;
   bool &enable_das_batch_rescans = get_enable_das_batch_rescans();
-  if (DistAlgo::DIST_NONE_ALL != get_distributed_algo()) {
+  if (OB_ISNULL(get_plan())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null", K(ret));
+  } else if (!get_plan()->get_optimizer_context().enable_spf_batch_rescan()) {
+    // controlled by _enable_spf_batch_rescan, off by default
+    enable_das_batch_rescans = false;
+  } else if (DistAlgo::DIST_NONE_ALL != get_distributed_algo()) {
     // do nothing
   } else if (OB_FAIL(check_if_match_das_batch_rescan(enable_das_batch_rescans))) {
     LOG_WARN("failed to check match das batch rescan", K(ret));
@@ -1379,6 +1379,54 @@ int ObTableLocation::calculate_partition_ids_by_rowkey(ObSQLSessionInfo &session
   return ret;
 }
 
+int ObTableLocation::calculate_tablet_id_of_each_rowkey(ObSQLSessionInfo &session_info,
+                                                        ObSchemaGetterGuard &schema_guard,
+                                                        uint64_t table_id,
+                                                        const ObIArray<ObRowkey> &rowkeys,
+                                                        ObIArray<ObTabletID> &tablet_ids)
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator allocator(ObModIds::OB_SQL_TABLE_LOCATION);
+  tablet_ids.reuse();
+  SMART_VAR(ObExecContext, exec_ctx, allocator) {
+    ObSqlSchemaGuard sql_schema_guard;
+    sql_schema_guard.set_schema_guard(&schema_guard);
+    exec_ctx.set_my_session(&session_info);
+    ObDASTabletMapper tablet_mapper;
+    ObSEArray<ObRowkey, 1> one_rowkey;
+    ObSEArray<ObTabletID, 1> one_tablet;
+    ObSEArray<ObObjectID, 1> one_part;
+    if (OB_FAIL(exec_ctx.get_das_ctx().get_das_tablet_mapper(table_id, tablet_mapper,
+                                                            &loc_meta_.related_table_ids_))) {
+      LOG_WARN("fail to get das tablet mapper", K(ret));
+    } else if (OB_UNLIKELY(is_virtual_table(table_id))) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "Calculate virtual table partition id with rowkey");
+    } else if (OB_FAIL(init_table_location_with_rowkey(sql_schema_guard, table_id, exec_ctx))) {
+      LOG_WARN("implicit init location failed", K(table_id), K(ret));
+    }
+    // the location is initialized once, each rowkey is calculated on its own since the
+    // partition id calculation dedups its output
+    for (int64_t i = 0; OB_SUCC(ret) && i < rowkeys.count(); ++i) {
+      one_rowkey.reuse();
+      one_tablet.reuse();
+      one_part.reuse();
+      if (OB_FAIL(one_rowkey.push_back(rowkeys.at(i)))) {
+        LOG_WARN("failed to push back", K(ret));
+      } else if (OB_FAIL(calc_partition_ids_by_rowkey(exec_ctx, tablet_mapper, one_rowkey,
+                                                      one_tablet, one_part))) {
+        LOG_WARN("calc parttion ids by rowkey failed", K(ret), K(i));
+      } else if (OB_UNLIKELY(1 != one_tablet.count())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("one rowkey should belong to one tablet", K(ret), K(one_tablet));
+      } else if (OB_FAIL(tablet_ids.push_back(one_tablet.at(0)))) {
+        LOG_WARN("failed to push back", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTableLocation::calculate_tablet_id_by_row(ObExecContext &exec_ctx,
                                                 uint64_t table_id,
                                                 const ObIArray<uint64_t> &column_ids,
@@ -1531,6 +1579,8 @@ int ObTableLocation::get_tablet_locations(ObDASCtx &das_ctx,
     } else {
       ObDASLocationRouter &loc_router = das_ctx.get_location_router();
       ObLSLocation location;
+      bool is_tablet_cache_hit = true;
+      bool prefetched = false;
       for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
         location.reset();
         ObCandiTabletLoc &candi_tablet_loc = candi_tablet_locs.at(i);
@@ -1542,9 +1592,25 @@ int ObTableLocation::get_tablet_locations(ObDASCtx &das_ctx,
                                         location);
         } else if (nonblock) {
           //TODO shengle use nonblock after location service support nonblock interface
-          ret = loc_router.get(loc_meta_, tablet_ids.at(i), location);
+          ret = loc_router.get(loc_meta_, tablet_ids.at(i), location, is_tablet_cache_hit);
         } else {
-          ret = loc_router.get(loc_meta_, tablet_ids.at(i), location);
+          ret = loc_router.get(loc_meta_, tablet_ids.at(i), location, is_tablet_cache_hit);
+        }
+        if (OB_SUCC(ret) && !is_tablet_cache_hit && !prefetched && i + 2 < N) {
+          // the cache is cold, renew the rest of the tablets with batch inner sql instead of
+          // one per tablet. Failure is fine since get() will renew them one by one.
+          int tmp_ret = OB_SUCCESS;
+          ObSEArray<ObTabletID, 16> rest_tablet_ids;
+          prefetched = true;
+          for (int64_t j = i + 1; OB_SUCCESS == tmp_ret && j < N; ++j) {
+            tmp_ret = rest_tablet_ids.push_back(tablet_ids.at(j));
+          }
+          if (OB_SUCCESS == tmp_ret) {
+            tmp_ret = loc_router.prefetch(loc_meta_, rest_tablet_ids);
+          }
+          if (OB_SUCCESS != tmp_ret) {
+            LOG_WARN("prefetch tablet locations failed", K(tmp_ret), K(ref_table_id), K(i), K(N));
+          }
         }
         if (OB_FAIL(ret)) {
           //TODO shengle set partition key for location cache renew
@@ -631,6 +631,13 @@ public:
                                          const common::ObIArray<ObRowkey> &rowkeys,
                                          ObIArray<ObTabletID> &tablet_ids,
                                          ObIArray<ObObjectID> &part_ids);
+  // unlike calculate_partition_ids_by_rowkey, the output is not deduplicated:
+  // tablet_ids.at(i) is the tablet of rowkeys.at(i)
+  int calculate_tablet_id_of_each_rowkey(ObSQLSessionInfo &session_info,
+                                         share::schema::ObSchemaGetterGuard &schema_guard,
+                                         uint64_t table_id,
+                                         const common::ObIArray<ObRowkey> &rowkeys,
+                                         ObIArray<ObTabletID> &tablet_ids);
 
   int calculate_tablet_id_by_row(ObExecContext &exec_ctx,
                                  uint64_t table_id,
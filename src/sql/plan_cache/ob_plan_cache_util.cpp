@@ -379,7 +379,7 @@ int ObPhyLocationGetter::build_related_tablet_info(const ObTableLocation &table_
   return ret;
 }
 
-OB_SERIALIZE_MEMBER(ObTableRowCount, op_id_, row_count_);
+OB_SERIALIZE_MEMBER(ObTableRowCount, op_id_, row_count_, est_row_count_);
 
 int ObConfigInfoInPC::load_influence_plan_config()
 {
@@ -399,6 +399,7 @@ int ObConfigInfoInPC::load_influence_plan_config()
     pushdown_storage_level_ = tenant_config->_pushdown_storage_level;
     rowsets_enabled_ = tenant_config->_rowsets_enabled;
     enable_px_batch_rescan_ = tenant_config->_enable_px_batch_rescan;
+    enable_spf_batch_rescan_ = tenant_config->_enable_spf_batch_rescan;
     bloom_filter_enabled_ = tenant_config->_bloom_filter_enabled;
   }
 
@@ -421,6 +422,9 @@ int ObConfigInfoInPC::serialize_configs(char *buf, int buf_len, int64_t &pos)
   } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
                               "%d,", enable_px_batch_rescan_))) {
     SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_px_batch_rescan_));
+  } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+                              "%d,", enable_spf_batch_rescan_))) {
+    SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_spf_batch_rescan_));
   } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
                               "%d,", enable_px_ordered_coord_))) {
     SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_px_ordered_coord_));
@@ -431,10 +431,13 @@ struct ObTableRowCount
 {
   int64_t op_id_;
   int64_t row_count_;
+  // rows estimated by optimizer for the same range, -1 if unknown, used for cardinality feedback
+  int64_t est_row_count_;
 
-  ObTableRowCount() : op_id_(OB_INVALID_ID), row_count_(0) {}
-  ObTableRowCount(int64_t op_id, int64_t row_count) : op_id_(op_id), row_count_(row_count) {}
-  TO_STRING_KV(K_(op_id), K_(row_count));
+  ObTableRowCount() : op_id_(OB_INVALID_ID), row_count_(0), est_row_count_(-1) {}
+  ObTableRowCount(int64_t op_id, int64_t row_count, int64_t est_row_count = -1)
+    : op_id_(op_id), row_count_(row_count), est_row_count_(est_row_count) {}
+  TO_STRING_KV(K_(op_id), K_(row_count), K_(est_row_count));
 
   OB_UNIS_VERSION(1);
 };
@@ -927,6 +930,7 @@ public:
   : pushdown_storage_level_(DEFAULT_PUSHDOWN_STORAGE_LEVEL),
     rowsets_enabled_(false),
     enable_px_batch_rescan_(true),
+    enable_spf_batch_rescan_(false),
     bloom_filter_enabled_(true),
     enable_newsort_(true),
     cluster_config_version_(-1),
@@ -962,6 +966,7 @@ public:
   int pushdown_storage_level_;
   bool rowsets_enabled_;
   bool enable_px_batch_rescan_;
+  bool enable_spf_batch_rescan_;
   bool enable_px_ordered_coord_;
   bool bloom_filter_enabled_;
   bool enable_newsort_;
@@ -1949,6 +1949,9 @@ int ObBasicSessionInfo::set_cur_phy_plan(ObPhysicalPlan *cur_phy_plan)
     int64_t len = cur_phy_plan->stat_.sql_id_.length();
     MEMCPY(sql_id_, cur_phy_plan->stat_.sql_id_.ptr(), len);
     sql_id_[len] = '\0';
+    // keep the thread bound ash stat tagged for cpu profile samples
+    ash_stat_.plan_id_ = plan_id_;
+    MEMCPY(ash_stat_.sql_id_, sql_id_, len + 1);
   }
   return ret;
 }
@@ -1961,6 +1964,7 @@ void ObBasicSessionInfo::set_cur_sql_id(char *sql_id)
   } else {
     MEMCPY(sql_id_, sql_id, common::OB_MAX_SQL_ID_LENGTH + 1);
   }
+  MEMCPY(ash_stat_.sql_id_, sql_id_, common::OB_MAX_SQL_ID_LENGTH + 1);
 }
 
 void ObBasicSessionInfo::get_cur_sql_id(char *sql_id_buf, int64_t sql_id_buf_size) const
@@ -5053,6 +5057,8 @@ int ObBasicSessionInfo::set_session_active(const ObString &sql,
     thread_data_.cur_query_start_time_ = query_receive_ts;
     thread_data_.mysql_cmd_ = cmd;
     thread_data_.last_active_time_ = last_active_time_ts;
+    ash_stat_.tenant_id_ = get_effective_tenant_id();
+    ash_stat_.session_id_ = get_sessid();
     ObActiveSessionGuard::setup_ash(ash_stat_);
   }
   return ret;
@@ -5069,6 +5075,8 @@ int ObBasicSessionInfo::set_session_active(const ObString &label,
     LOG_WARN("fail to set session state", K(ret));
   } else {
     thread_data_.mysql_cmd_ = cmd;
+    ash_stat_.tenant_id_ = get_effective_tenant_id();
+    ash_stat_.session_id_ = get_sessid();
     ObActiveSessionGuard::setup_ash(ash_stat_);
   }
   return ret;
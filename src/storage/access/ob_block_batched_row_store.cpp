@@ -110,16 +110,40 @@ int ObBlockBatchedRowStore::filter_micro_block_batch(
   int64_t last_start = cur_row_index;
   int64_t capacity = row_capacity_;
   ObSEArray<common::ObDatum *, 4> datums;
+  // rows already filtered by the former children of an AND node are not decoded
+  const common::ObBitmap *selected = nullptr;
+  if (nullptr != parent && parent->is_logic_and_node() && nullptr != parent->get_result()
+      && !parent->get_result()->is_all_true()) {
+    selected = parent->get_result();
+  }
   if (OB_FAIL(filter.get_datums_from_column(datums))) {
     LOG_WARN("failed to get filter column datums", K(ret));
   } else {
     while (OB_SUCC(ret) && cur_row_index < end_row_index) {
       last_start = cur_row_index;
       int64_t filter_rows = min(batch_size_, end_row_index - cur_row_index);
+      int64_t selected_rows = 0;
       if (0 == filter.get_col_count()) {
         cur_row_index +=  filter_rows;
       } else if (OB_FAIL(reuse_capacity(filter_rows))) {
         LOG_WARN("failed to reuse vector store", K(ret));
+      } else if (nullptr != selected) {
+        if (OB_FAIL(copy_filter_rows(
+                    &block_reader,
+                    cur_row_index,
+                    last_start + filter_rows,
+                    *selected,
+                    filter.get_col_offsets(),
+                    filter.get_col_params(),
+                    datums,
+                    selected_rows))) {
+          LOG_WARN("failed to get selected rows", K(ret), K(cur_row_index), K(*this));
+        } else if (0 == selected_rows) {
+          // all rows in this batch are already filtered
+        } else if (OB_FAIL(filter.filter_batch(row_ids_, selected_rows, result_bitmap))) {
+          LOG_WARN("failed to filter selected rows", K(ret), K(last_start), K(selected_rows));
+        }
+        continue;
       } else if (OB_FAIL(copy_filter_rows(
                   &block_reader,
                   cur_row_index,
@@ -178,6 +202,45 @@ int ObBlockBatchedRowStore::copy_filter_rows(
   return ret;
 }
 
+int ObBlockBatchedRowStore::copy_filter_rows(
+    blocksstable::ObMicroBlockDecoder *reader,
+    int64_t &begin_index,
+    const int64_t end_index,
+    const common::ObBitmap &selected,
+    const common::ObIArray<int32_t> &cols,
+    const common::ObIArray<const share::schema::ObColumnParam *> &col_params,
+    common::ObIArray<common::ObDatum *> &datums,
+    int64_t &row_count)
+{
+  int ret = OB_SUCCESS;
+  row_count = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("vector store is not inited", K(ret));
+  } else if (OB_ISNULL(reader)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null reader", K(ret));
+  } else if (!is_empty()) {
+    // defense code: fill rows banned when there is row copied in the front
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected vector store count", K(ret), KPC(this));
+  } else if (OB_FAIL(get_row_ids(reader, begin_index, end_index, row_count, false, &selected))) {
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("fail to get row ids", K(ret), K(begin_index), K(end_index));
+    }
+  } else if (0 == row_count) {
+    // skip if no rows selected
+  } else if (OB_FAIL(reader->get_rows(cols, col_params, row_ids_, cell_data_ptrs_, row_count, datums))) {
+    LOG_WARN("fail to copy rows", K(ret), K(cols), K(row_count),
+             "row_ids", common::ObArrayWrap<const int64_t>(row_ids_, row_count));
+  }
+  LOG_TRACE("[Vectorized] vector store copy selected filter rows", K(ret),
+            K(begin_index), K(end_index), K(row_count),
+            "row_ids", common::ObArrayWrap<const int64_t>(row_ids_, row_count),
+            KPC(this));
+  return ret;
+}
+
 int ObBlockBatchedRowStore::get_row_ids(
     blocksstable::ObIMicroBlockReader *reader,
     int64_t &begin_index,
@@ -81,6 +81,15 @@ protected:
       const common::ObIArray<int32_t> &cols,
       const common::ObIArray<const share::schema::ObColumnParam *> &col_params,
       common::ObIArray<common::ObDatum *> &datums);
+  int copy_filter_rows(
+      blocksstable::ObMicroBlockDecoder *reader,
+      int64_t &begin_index,
+      const int64_t end_index,
+      const common::ObBitmap &selected,
+      const common::ObIArray<int32_t> &cols,
+      const common::ObIArray<const share::schema::ObColumnParam *> &col_params,
+      common::ObIArray<common::ObDatum *> &datums,
+      int64_t &row_count);
   IterEndState iter_end_flag_;
   int64_t batch_size_;
   int64_t row_capacity_;
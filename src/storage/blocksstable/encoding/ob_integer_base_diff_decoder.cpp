@@ -17,6 +17,7 @@
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "ob_bit_stream.h"
 #include "ob_integer_array.h"
+#include "ob_raw_decoder.h"
 
 namespace oceanbase
 {
@@ -416,6 +417,11 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
             }
           }
         }
+      } else if (!exist_parent_filter && fast_filter_valid(col_ctx)) {
+        if (OB_FAIL(fast_comparison_operator(
+                    col_ctx, col_data, cmp_op_type, param_delta_value, result_bitmap))) {
+          LOG_WARN("Failed on fast comparison operator", K(ret), K(col_ctx));
+        }
       } else {
         data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
         for (int64_t row_id = 0;
@@ -442,6 +448,68 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
   return ret;
 }
 
+bool ObIntegerBaseDiffDecoder::fast_filter_valid(const ObColumnDecoderCtx &col_ctx) const
+{
+  const int64_t cell_len = header_->length_;
+  return !col_ctx.has_extend_value()
+      && !col_ctx.is_bit_packing()
+      && raw_fix_fast_filter_funcs_inited
+      && (1 == cell_len || 2 == cell_len || 4 == cell_len || 8 == cell_len);
+}
+
+// Deltas are stored as fixed length unsigned integers without extend value,
+// so the comparison can be done on the column data in batch with the same
+// (possibly SIMD) filter kernels as the raw decoder.
+int ObIntegerBaseDiffDecoder::fast_comparison_operator(
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const ObFPIntCmpOpType cmp_op_type,
+    const uint64_t param_delta_value,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t cell_len = header_->length_;
+  const int64_t row_cnt = col_ctx.micro_block_header_->row_count_;
+  if (cell_len < 8 && param_delta_value > INTEGER_MASK_TABLE[cell_len]) {
+    // param is larger than any stored delta
+    if (FP_INT_OP_LT == cmp_op_type || FP_INT_OP_LE == cmp_op_type || FP_INT_OP_NE == cmp_op_type) {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to set result bitmap to all true", K(ret));
+      }
+    }
+  } else {
+    int32_t white_op_type = sql::WHITE_OP_MAX;
+    switch (cmp_op_type) {
+      case FP_INT_OP_EQ: white_op_type = sql::WHITE_OP_EQ; break;
+      case FP_INT_OP_LE: white_op_type = sql::WHITE_OP_LE; break;
+      case FP_INT_OP_LT: white_op_type = sql::WHITE_OP_LT; break;
+      case FP_INT_OP_GE: white_op_type = sql::WHITE_OP_GE; break;
+      case FP_INT_OP_GT: white_op_type = sql::WHITE_OP_GT; break;
+      case FP_INT_OP_NE: white_op_type = sql::WHITE_OP_NE; break;
+      default: break;
+    }
+    if (OB_UNLIKELY(sql::WHITE_OP_MAX == white_op_type)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected compare operator type", K(ret), K(cmp_op_type));
+    } else {
+      int64_t size = sql::ObBitVector::memory_size(row_cnt);
+      // Use BitVector to set the result of filter here because the memory of ObBitMap is not continuous
+      char buf[size];
+      sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+      bit_vec->reset(row_cnt);
+      fix_filter_func fast_filter_func = raw_fix_fast_filter_funcs
+          [0]
+          [get_value_len_tag_map()[cell_len]]
+          [white_op_type];
+      fast_filter_func(row_cnt, col_data, param_delta_value, *bit_vec);
+      if (OB_FAIL(result_bitmap.load_blocks_from_array(reinterpret_cast<uint64_t *>(buf), row_cnt))) {
+        LOG_WARN("Failed to load bitmap from array on stack", K(ret), KP(buf), K(row_cnt));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObIntegerBaseDiffDecoder::bt_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
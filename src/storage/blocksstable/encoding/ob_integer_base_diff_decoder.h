@@ -97,6 +97,15 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  bool fast_filter_valid(const ObColumnDecoderCtx &col_ctx) const;
+
+  int fast_comparison_operator(
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const ObFPIntCmpOpType cmp_op_type,
+      const uint64_t param_delta_value,
+      ObBitmap &result_bitmap) const;
+
   int bt_operator(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
@@ -644,6 +644,8 @@ int ObMicroBlockEncoder::build_block(char *&buf, int64_t &size)
         if (idx < ctx_.previous_encodings_.count()) {
           if (OB_FAIL(ctx_.previous_encodings_.at(idx).put(pe))) {
             LOG_WARN("failed to store previous encoding", K(ret), K(idx), K(pe));
+          } else {
+            ctx_.previous_encodings_.at(idx).record_size(e->calc_size(), datum_rows_.count());
           }
 
           //if (ctx_->previous_encodings_.at(idx).last_1 != pe.type_) {
@@ -655,6 +657,7 @@ int ObMicroBlockEncoder::build_block(char *&buf, int64_t &size)
           ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> pe_array;
           if (OB_FAIL(pe_array.put(pe))) {
             LOG_WARN("failed to store previous encoding", K(ret), K(idx), K(pe));
+          } else if (FALSE_IT(pe_array.record_size(e->calc_size(), datum_rows_.count()))) {
           } else if (OB_FAIL(ctx_.previous_encodings_.push_back(pe_array))) {
             LOG_WARN("push back previous encoding failed");
           }
@@ -1318,17 +1321,7 @@ int ObMicroBlockEncoder::try_previous_encoder(ObIColumnEncoder *&choose,
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid argument", K(ret), K(column_index));
   } else {
-    bool need_calc = false;
-    int64_t cycle_cnt = 0;
-    if (32 < ctx_.micro_block_cnt_) {
-      cycle_cnt = 16;
-    } else if (16 < ctx_.micro_block_cnt_) {
-      cycle_cnt = 8;
-    } else {
-      cycle_cnt = 4;
-    }
-    need_calc = (0 == ctx_.micro_block_cnt_ % cycle_cnt);
-
+    const bool need_calc = need_recalc_encoding();
     if (column_index < ctx_.previous_encodings_.count()) {
       int64_t pos = ctx_.previous_encodings_.at(column_index).last_pos_;
       ObPreviousEncoding *prev = NULL;
@@ -1360,6 +1353,91 @@ int ObMicroBlockEncoder::try_previous_encoder(ObIColumnEncoder *&choose,
   return ret;
 }
 
+int ObMicroBlockEncoder::try_stable_previous_encoder(ObIColumnEncoder *&e,
+    const int64_t column_index)
+{
+  int ret = OB_SUCCESS;
+  e = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(column_index < 0 || column_index > ctx_.column_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(column_index));
+  } else if (column_index >= ctx_.previous_encodings_.count() || need_recalc_encoding()) {
+    // no history or sampling round, evaluate all encodings
+  } else {
+    const ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> &pe_array =
+        ctx_.previous_encodings_.at(column_index);
+    const ObPreviousEncoding &prev = pe_array.prev_encodings_[pe_array.last_pos_];
+    const int64_t row_cnt = datum_rows_.count();
+    if (pe_array.size_ <= 0
+        || pe_array.stable_cnt_ < STABLE_ENCODING_THRESHOLD
+        || pe_array.last_row_cnt_ <= 0
+        || ObColumnHeader::RAW == prev.type_) {
+      // raw encoding is always tried first, nothing to save
+    } else if (OB_FAIL(try_previous_encoder(e, column_index, prev))) {
+      LOG_WARN("try previous encoding failed", K(ret), K(column_index), K(prev));
+    } else if (NULL != e) {
+      // compare size per row with the last micro block to detect data drift
+      if (e->calc_size() * pe_array.last_row_cnt_ * 100
+          > pe_array.last_size_ * row_cnt * (100 + ENCODING_SIZE_DRIFT_PCT)) {
+        LOG_DEBUG("column data drifted, evaluate all encodings", K(column_index),
+            "size", e->calc_size(), K(row_cnt), K(pe_array));
+        free_encoder(e);
+        e = NULL;
+      } else {
+        LOG_DEBUG("reuse stable previous encoding", K(column_index), K(pe_array));
+      }
+    }
+  }
+  return ret;
+}
+
+bool ObMicroBlockEncoder::need_recalc_encoding() const
+{
+  int64_t cycle_cnt = 0;
+  if (32 < ctx_.micro_block_cnt_) {
+    cycle_cnt = 16;
+  } else if (16 < ctx_.micro_block_cnt_) {
+    cycle_cnt = 8;
+  } else {
+    cycle_cnt = 4;
+  }
+  return 0 == ctx_.micro_block_cnt_ % cycle_cnt;
+}
+
+bool ObMicroBlockEncoder::is_better_encoder(const ObIColumnEncoder &candidate,
+    const ObIColumnEncoder &current) const
+{
+  return candidate.calc_size() * (100 + get_decode_cost_pct(candidate.get_type()))
+      < current.calc_size() * (100 + get_decode_cost_pct(current.get_type()));
+}
+
+// Extra cost in percent of encoded size, encodings need per row reconstruction
+// while decoding should save enough space to be chosen.
+int64_t ObMicroBlockEncoder::get_decode_cost_pct(const ObColumnHeader::Type type)
+{
+  int64_t pct = 0;
+  switch (type) {
+    case ObColumnHeader::STRING_DIFF:
+    case ObColumnHeader::HEX_PACKING: {
+      pct = 5;
+      break;
+    }
+    case ObColumnHeader::STRING_PREFIX:
+    case ObColumnHeader::COLUMN_SUBSTR: {
+      pct = 10;
+      break;
+    }
+    default: {
+      pct = 0;
+      break;
+    }
+  }
+  return pct;
+}
+
 template <typename T>
 int ObMicroBlockEncoder::try_span_column_encoder(ObIColumnEncoder *&e,
     const int64_t column_index)
@@ -1469,23 +1547,28 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
 {
   int ret = OB_SUCCESS;
   ObIColumnEncoder *e = NULL;
+  bool reuse_stable = false;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     LOG_WARN("not init", K(ret));
   } else if (OB_UNLIKELY(column_idx < 0 || column_idx >= ctx_.column_cnt_)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid column_idx", K(column_idx), K(ret));
-  } else if (OB_FAIL(try_encoder<ObRawEncoder>(e, column_idx))) {
+  } else if (OB_FAIL(try_stable_previous_encoder(e, column_idx))) {
+    LOG_WARN("try stable previous encoder failed", K(ret), K(column_idx));
+  } else if (FALSE_IT(reuse_stable = (NULL != e))) {
+  } else if (!reuse_stable && OB_FAIL(try_encoder<ObRawEncoder>(e, column_idx))) {
     LOG_WARN("try raw encoder failed", K(ret));
   } else if (NULL == e) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("raw encoder can not be disabled and must always be suitable",
         K(ret), K(column_idx));
   } else {
-    bool try_more = true;
+    bool try_more = !reuse_stable;
     ObIColumnEncoder *choose = e;
     int64_t acceptable_size = choose->calc_size() / 4;
-    if (OB_FAIL(try_encoder<ObDictEncoder>(e, column_idx))) {
+    if (!try_more) {
+    } else if (OB_FAIL(try_encoder<ObDictEncoder>(e, column_idx))) {
       LOG_WARN("try dict encoder failed", K(ret), K(column_idx));
     } else if (NULL != e) {
       if (e->calc_size() < choose->calc_size()) {
@@ -1532,7 +1615,7 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
         } else if (OB_FAIL(try_span_column_encoder<ObInterColSubStrEncoder>(e, column_idx))) {
           LOG_WARN("try inter column substring encoder failed", K(ret), K(column_idx));
         } else if (NULL != e) {
-          if (e->calc_size() < choose->calc_size()) {
+          if (is_better_encoder(*e, *choose)) {
             free_encoder(choose);
             choose = e;
             if (choose->calc_size() <= acceptable_size) {
@@ -1608,7 +1691,7 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
           LOG_WARN("try string diff encoder failed", K(ret), K(column_idx));
         } else if (NULL != e) {
           int64_t size = e->calc_size();
-          if (size < choose->calc_size()) {
+          if (is_better_encoder(*e, *choose)) {
             free_encoder(choose);
             choose = e;
             try_more = size <= acceptable_size;
@@ -1629,7 +1712,7 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
           LOG_WARN("try string prefix encoder failed", K(ret), K(column_idx));
         } else if (NULL != e) {
           int64_t size = e->calc_size();
-          if (size < choose->calc_size()) {
+          if (is_better_encoder(*e, *choose)) {
             free_encoder(choose);
             choose = e;
             try_more = size <= acceptable_size;
@@ -1649,7 +1732,7 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
           LOG_WARN("try hex string encoder failed", K(ret), K(column_idx));
         } else if (NULL != e) {
           int64_t size = e->calc_size();
-          if (size < choose->calc_size()) {
+          if (is_better_encoder(*e, *choose)) {
             free_encoder(choose);
             choose = e;
             try_more = size <= acceptable_size;
@@ -55,6 +55,12 @@ public:
   // For rowkey_buffer_, length, must great than OB_MAX_ROW_KEY_LENGTH
   static const int64_t DEFAULT_ROWKEY_BUFFER_SIZE = 20 * 1024;
 
+  // Column keeps the encoding of previous micro blocks without a full evaluation
+  // once it has been chosen for STABLE_ENCODING_THRESHOLD consecutive micro blocks,
+  // unless its size per row grows more than ENCODING_SIZE_DRIFT_PCT.
+  static const int64_t STABLE_ENCODING_THRESHOLD = 3;
+  static const int64_t ENCODING_SIZE_DRIFT_PCT = 10;
+
   struct CellCopyIndex
   {
     uint32_t index_;
@@ -125,6 +131,13 @@ private:
   int try_previous_encoder(ObIColumnEncoder *&e,
       const int64_t column_index,
       const int64_t acceptable_size, bool &try_more);
+  // reuse encoding of previous micro blocks directly if it is stable and
+  // still fits current data, %e is NULL if a full evaluation is needed.
+  int try_stable_previous_encoder(ObIColumnEncoder *&e, const int64_t column_index);
+  bool need_recalc_encoding() const;
+  // compare encoded size weighted by decoding cost
+  bool is_better_encoder(const ObIColumnEncoder &candidate, const ObIColumnEncoder &current) const;
+  static int64_t get_decode_cost_pct(const ObColumnHeader::Type type);
 
   template <typename T>
   int try_span_column_encoder(ObIColumnEncoder *&e, const int64_t column_idx);
@@ -146,6 +146,135 @@ struct RawFixFilterAVX512Func_T<0, 0, CMP_TYPE>
         "stored_values", common::ObArrayWrap<uint8_t>(stored_values, row_cnt));
   }
 };
+template <int CMP_TYPE>
+struct RawFixFilterAVX512Func_T<1, 2, CMP_TYPE>
+{
+  // Fast filter with SIMD for 4 byte signed data
+  static void fix_filter_func(
+      const int64_t row_cnt,
+      const unsigned char *col_data,
+      const uint64_t node_value,
+      sql::ObBitVector &res)
+  {
+    const int32_t *stored_values = reinterpret_cast<const int32_t *>(col_data);
+    int32_t casted_node_value = *reinterpret_cast<const int32_t *>(&node_value);
+    constexpr static int op = ObCmpTypeToAvxOpMap<CMP_TYPE>::value_;
+
+    __m256i node_value_vec = _mm256_set1_epi32(casted_node_value);
+    for (int64_t i = 0; i < row_cnt / 8; i++) {
+      __m256i data_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(col_data + i * 32));
+      res.reinterpret_data<uint8_t>()[i] = _mm256_cmp_epi32_mask(data_vec, node_value_vec, op);
+    }
+
+    for (int64_t row_id = row_cnt / 8 * 8; row_id < row_cnt; row_id++) {
+      if (value_cmp_t<int32_t, CMP_TYPE>(stored_values[row_id], casted_node_value)) {
+        res.set(row_id);
+      }
+    }
+    LOG_DEBUG("[SIMD filter] fast filter for 4 byte signed data",
+        K(row_cnt), K(node_value), K(casted_node_value), K(op),
+        "stored_values", common::ObArrayWrap<int32_t>(stored_values, row_cnt));
+  }
+};
+
+template <int CMP_TYPE>
+struct RawFixFilterAVX512Func_T<0, 2, CMP_TYPE>
+{
+  // Fast filter with SIMD for 4 byte unsigned data
+  static void fix_filter_func(
+      const int64_t row_cnt,
+      const unsigned char *col_data,
+      const uint64_t node_value,
+      sql::ObBitVector &res)
+  {
+    const uint32_t *stored_values = reinterpret_cast<const uint32_t *>(col_data);
+    uint32_t casted_node_value = *reinterpret_cast<const uint32_t *>(&node_value);
+    constexpr static int op = ObCmpTypeToAvxOpMap<CMP_TYPE>::value_;
+
+    __m256i node_value_vec = _mm256_set1_epi32(casted_node_value);
+    for (int64_t i = 0; i < row_cnt / 8; i++) {
+      __m256i data_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(col_data + i * 32));
+      res.reinterpret_data<uint8_t>()[i] = _mm256_cmp_epu32_mask(data_vec, node_value_vec, op);
+    }
+
+    for (int64_t row_id = row_cnt / 8 * 8; row_id < row_cnt; row_id++) {
+      if (value_cmp_t<uint32_t, CMP_TYPE>(stored_values[row_id], casted_node_value)) {
+        res.set(row_id);
+      }
+    }
+    LOG_DEBUG("[SIMD filter] fast filter for 4 byte unsigned data",
+        K(row_cnt), K(node_value), K(casted_node_value), K(op),
+        "stored_values", common::ObArrayWrap<uint32_t>(stored_values, row_cnt));
+  }
+};
+
+template <int CMP_TYPE>
+struct RawFixFilterAVX512Func_T<1, 3, CMP_TYPE>
+{
+  // Fast filter with SIMD for 8 byte signed data, two 4-lane compares fill one byte of result
+  static void fix_filter_func(
+      const int64_t row_cnt,
+      const unsigned char *col_data,
+      const uint64_t node_value,
+      sql::ObBitVector &res)
+  {
+    const int64_t *stored_values = reinterpret_cast<const int64_t *>(col_data);
+    int64_t casted_node_value = *reinterpret_cast<const int64_t *>(&node_value);
+    constexpr static int op = ObCmpTypeToAvxOpMap<CMP_TYPE>::value_;
+
+    __m256i node_value_vec = _mm256_set1_epi64x(casted_node_value);
+    for (int64_t i = 0; i < row_cnt / 8; i++) {
+      __m256i lo_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(col_data + i * 64));
+      __m256i hi_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(col_data + i * 64 + 32));
+      const uint8_t lo_mask = _mm256_cmp_epi64_mask(lo_vec, node_value_vec, op);
+      const uint8_t hi_mask = _mm256_cmp_epi64_mask(hi_vec, node_value_vec, op);
+      res.reinterpret_data<uint8_t>()[i] = static_cast<uint8_t>(lo_mask | (hi_mask << 4));
+    }
+
+    for (int64_t row_id = row_cnt / 8 * 8; row_id < row_cnt; row_id++) {
+      if (value_cmp_t<int64_t, CMP_TYPE>(stored_values[row_id], casted_node_value)) {
+        res.set(row_id);
+      }
+    }
+    LOG_DEBUG("[SIMD filter] fast filter for 8 byte signed data",
+        K(row_cnt), K(node_value), K(casted_node_value), K(op),
+        "stored_values", common::ObArrayWrap<int64_t>(stored_values, row_cnt));
+  }
+};
+
+template <int CMP_TYPE>
+struct RawFixFilterAVX512Func_T<0, 3, CMP_TYPE>
+{
+  // Fast filter with SIMD for 8 byte unsigned data, two 4-lane compares fill one byte of result
+  static void fix_filter_func(
+      const int64_t row_cnt,
+      const unsigned char *col_data,
+      const uint64_t node_value,
+      sql::ObBitVector &res)
+  {
+    const uint64_t *stored_values = reinterpret_cast<const uint64_t *>(col_data);
+    uint64_t casted_node_value = node_value;
+    constexpr static int op = ObCmpTypeToAvxOpMap<CMP_TYPE>::value_;
+
+    __m256i node_value_vec = _mm256_set1_epi64x(static_cast<int64_t>(casted_node_value));
+    for (int64_t i = 0; i < row_cnt / 8; i++) {
+      __m256i lo_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(col_data + i * 64));
+      __m256i hi_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(col_data + i * 64 + 32));
+      const uint8_t lo_mask = _mm256_cmp_epu64_mask(lo_vec, node_value_vec, op);
+      const uint8_t hi_mask = _mm256_cmp_epu64_mask(hi_vec, node_value_vec, op);
+      res.reinterpret_data<uint8_t>()[i] = static_cast<uint8_t>(lo_mask | (hi_mask << 4));
+    }
+
+    for (int64_t row_id = row_cnt / 8 * 8; row_id < row_cnt; row_id++) {
+      if (value_cmp_t<uint64_t, CMP_TYPE>(stored_values[row_id], casted_node_value)) {
+        res.set(row_id);
+      }
+    }
+    LOG_DEBUG("[SIMD filter] fast filter for 8 byte unsigned data",
+        K(row_cnt), K(node_value), K(casted_node_value), K(op),
+        "stored_values", common::ObArrayWrap<uint64_t>(stored_values, row_cnt));
+  }
+};
 #endif
 
 template <int32_t IS_SIGNED, int32_t LEN_TAG, int32_t CMP_TYPE>
@@ -458,12 +458,22 @@ struct ObPreviousEncodingArray<2>
   ObPreviousEncoding prev_encodings_[2];
   int64_t last_pos_;
   int64_t size_;
+  // consecutive micro blocks choosing prev_encodings_[last_pos_]
+  int64_t stable_cnt_;
+  // column size and row count of the last micro block, used to detect data drift
+  int64_t last_size_;
+  int64_t last_row_cnt_;
 
-  ObPreviousEncodingArray() : last_pos_(0), size_(0) {}
+  ObPreviousEncodingArray() : last_pos_(0), size_(0), stable_cnt_(0), last_size_(0), last_row_cnt_(0) {}
 
   OB_INLINE int put(const ObPreviousEncoding &prev)
   {
     int ret = common::OB_SUCCESS;
+    if (0 < size_ && prev == prev_encodings_[last_pos_]) {
+      ++stable_cnt_;
+    } else {
+      stable_cnt_ = 1;
+    }
     if (0 == size_ || prev != prev_encodings_[last_pos_]) {
       if (2 == size_) {
         last_pos_ = (last_pos_ == 1) ? 0 : last_pos_ + 1;
@@ -479,10 +489,21 @@ struct ObPreviousEncodingArray<2>
     }
     return ret;
   }
-  void reuse() { size_ = 0; }
+  OB_INLINE void record_size(const int64_t size, const int64_t row_cnt)
+  {
+    last_size_ = size;
+    last_row_cnt_ = row_cnt;
+  }
+  void reuse()
+  {
+    size_ = 0;
+    stable_cnt_ = 0;
+    last_size_ = 0;
+    last_row_cnt_ = 0;
+  }
 
-  TO_STRING_KV(K_(last_pos), K_(size), "prev_encoding0", prev_encodings_[0],
-      "prev_encoding1", prev_encodings_[1]);
+  TO_STRING_KV(K_(last_pos), K_(size), K_(stable_cnt), K_(last_size), K_(last_row_cnt),
+      "prev_encoding0", prev_encodings_[0], "prev_encoding1", prev_encodings_[1]);
 };
 
 template<>
@@ -1143,11 +1143,17 @@ int ObMacroBlockWriter::check_micro_block_need_merge(
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid micro_block", K(micro_block), K(ret));
   } else {
-    if (micro_writer_->get_row_count() <= 0
-        && micro_block.header_.data_length_ > data_store_desc_->micro_block_size_ / 2) {
+    const int64_t half_micro_block_size = data_store_desc_->micro_block_size_ / 2;
+    if (micro_block.header_.data_length_ <= half_micro_block_size) {
+      need_merge = true;
+    } else if (micro_writer_->get_row_count() <= 0
+        || micro_writer_->get_block_size() > half_micro_block_size) {
       need_merge = false;
-    } else if (micro_writer_->get_block_size() > data_store_desc_->micro_block_size_ / 2
-        && micro_block.header_.data_length_ > data_store_desc_->micro_block_size_ / 2) {
+    } else if (micro_writer_->get_block_size() + micro_block.header_.data_length_
+        > data_store_desc_->micro_block_size_) {
+      // merging splits this micro block and leaves a small tail, which would then
+      // be merged with the next micro block again and so on until the end of the
+      // macro block. Flush the pending rows as a small micro block and reuse this one.
       need_merge = false;
     } else {
       need_merge = true;
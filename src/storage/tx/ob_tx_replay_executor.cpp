@@ -533,6 +533,9 @@ int ObTxReplayExecutor::replay_redo_in_memtable_(ObTxRedoLog &redo)
   }
 
   ret = (OB_ITER_END == ret) ? OB_SUCCESS : ret;
+  // the log may be retried after the tablet is changed, never keep the handle
+  // beyond one redo log
+  reset_cached_tablet_();
   // free ObRowKey's objs's memory
   THIS_WORKER.get_sql_arena_allocator().reset();
 
@@ -557,9 +560,9 @@ int ObTxReplayExecutor::replay_one_row_in_memtable_(ObMutatorRowHeader &row_head
 {
   int ret = OB_SUCCESS;
   lib::Worker::CompatMode mode;
-  ObTabletHandle tablet_handle;
+  ObTablet *tablet = nullptr;
 
-  if (OB_FAIL(ls_->replay_get_tablet(row_head.tablet_id_, log_ts_ns_, tablet_handle))) {
+  if (OB_FAIL(get_tablet_(row_head.tablet_id_, tablet))) {
     if (OB_TABLET_NOT_EXIST == ret) {
       ctx_->force_no_need_replay_checksum();
       ret = OB_SUCCESS;
@@ -576,7 +579,6 @@ int ObTxReplayExecutor::replay_one_row_in_memtable_(ObMutatorRowHeader &row_head
   } else if (OB_FAIL(get_compat_mode_(row_head.tablet_id_, mode))) {
     TRANS_LOG(WARN, "[Replay Tx] get compat mode error", K(ret), K(mode));
   } else {
-    ObTablet *tablet = tablet_handle.get_obj();
     storage::ObStoreCtx storeCtx;
     storeCtx.ls_id_ = ctx_->get_ls_id();
     storeCtx.mvcc_acc_ctx_.init_replay(
@@ -708,6 +710,30 @@ int ObTxReplayExecutor::replay_lock_(storage::ObStoreCtx &store_ctx,
   return ret;
 }
 
+int ObTxReplayExecutor::get_tablet_(const ObTabletID &tablet_id, ObTablet *&tablet)
+{
+  int ret = OB_SUCCESS;
+  tablet = nullptr;
+  if (cached_tablet_id_ != tablet_id || !cached_tablet_handle_.is_valid()) {
+    reset_cached_tablet_();
+    if (OB_FAIL(ls_->replay_get_tablet(tablet_id, log_ts_ns_, cached_tablet_handle_))) {
+      cached_tablet_handle_.reset();
+    } else {
+      cached_tablet_id_ = tablet_id;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    tablet = cached_tablet_handle_.get_obj();
+  }
+  return ret;
+}
+
+void ObTxReplayExecutor::reset_cached_tablet_()
+{
+  cached_tablet_id_.reset();
+  cached_tablet_handle_.reset();
+}
+
 int ObTxReplayExecutor::get_compat_mode_(const ObTabletID &tablet_id, lib::Worker::CompatMode &mode)
 {
   int ret = OB_SUCCESS;
@@ -17,7 +17,9 @@
 #include "storage/ob_i_table.h"
 
 #include "lib/worker.h"
+#include "common/ob_tablet_id.h"
 #include "storage/ob_storage_table_guard.h"
+#include "storage/meta_mem/ob_tablet_handle.h"
 
 namespace oceanbase
 {
@@ -68,7 +70,8 @@ public:
                KP(mt_ctx_),
                K(log_block_),
                K(lsn_),
-               K(log_ts_ns_));
+               K(log_ts_ns_),
+               K(cached_tablet_id_));
 
 private:
   ObTxReplayExecutor(storage::ObLS *ls,
@@ -77,7 +80,8 @@ private:
                      const int64_t &log_timestamp)
       : ctx_(nullptr), ls_(ls), ls_tx_srv_(ls_tx_srv), lsn_(lsn),
         log_ts_ns_(log_timestamp), mmi_ptr_(nullptr), mt_ctx_(nullptr), first_created_ctx_(false),
-        has_redo_(false), tx_part_log_no_(0), mvcc_row_count_(0), table_lock_row_count_(0)
+        has_redo_(false), tx_part_log_no_(0), mvcc_row_count_(0), table_lock_row_count_(0),
+        cached_tablet_id_(), cached_tablet_handle_()
   {}
 
   ~ObTxReplayExecutor() { ob_free(mmi_ptr_); }
@@ -120,6 +124,8 @@ private:
                    storage::ObTablet *tablet,
                    memtable::ObMemtableMutatorIterator *mmi_ptr,
                    memtable::ObEncryptRowBuf &row_buf);
+  int get_tablet_(const ObTabletID &tablet_id, storage::ObTablet *&tablet);
+  void reset_cached_tablet_();
   int get_compat_mode_(const ObTabletID &tablet_id, lib::Worker::CompatMode &mode);
   bool can_replay() const;
 
@@ -147,6 +153,11 @@ private:
   // memtable::ObMemtable * mem_store_;
   int64_t mvcc_row_count_;
   int64_t table_lock_row_count_;
+
+  // rows of a redo log are usually clustered by tablet, the handle of the
+  // last tablet is kept to avoid a tablet map lookup for every row
+  common::ObTabletID cached_tablet_id_;
+  storage::ObTabletHandle cached_tablet_handle_;
 };
 }
 } // namespace oceanbase
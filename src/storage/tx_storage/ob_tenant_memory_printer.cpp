@@ -107,6 +107,7 @@ int ObTenantMemoryPrinter::print_tenant_usage()
     _STORAGE_LOG(INFO,
         "[CHUNK_MGR] free=%ld pushes=%ld pops=%ld limit=%'15ld hold=%'15ld total_hold=%'15ld used=%'15ld" \
         " freelist_hold=%'15ld maps=%'15ld unmaps=%'15ld large_maps=%'15ld large_unmaps=%'15ld" \
+        " huge_page_maps=%'15ld huge_page_unmaps=%'15ld huge_page_hold=%'15ld huge_free=%ld" \
         " memalign=%d"
 #ifndef ENABLE_SANITY
         " virtual_memory_used=%'15ld\n",
@@ -125,6 +126,10 @@ int ObTenantMemoryPrinter::print_tenant_usage()
         CHUNK_MGR.get_unmaps(),
         CHUNK_MGR.get_large_maps(),
         CHUNK_MGR.get_large_unmaps(),
+        CHUNK_MGR.get_huge_page_maps(),
+        CHUNK_MGR.get_huge_page_unmaps(),
+        CHUNK_MGR.get_huge_page_hold(),
+        CHUNK_MGR.get_huge_free_chunk_count(),
         0,
 #ifndef ENABLE_SANITY
         memory_used
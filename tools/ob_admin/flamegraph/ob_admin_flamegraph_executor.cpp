@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "ob_admin_flamegraph_executor.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase
+{
+namespace tools
+{
+
+ObAdminFlameGraphExecutor::ObAdminFlameGraphExecutor()
+  : input_file_(NULL),
+    binary_file_(NULL),
+    output_file_(NULL),
+    stacks_(),
+    symbols_()
+{
+}
+
+ObAdminFlameGraphExecutor::~ObAdminFlameGraphExecutor()
+{
+}
+
+int ObAdminFlameGraphExecutor::execute(int argc, char *argv[])
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_FAIL(parse_cmd(argc - 1, argv + 1))) {
+    COMMON_LOG(ERROR, "Fail to parse cmd, ", K(ret));
+  } else if (OB_ISNULL(input_file_)) {
+    ret = OB_INVALID_ARGUMENT;
+    print_usage();
+  } else if (OB_FAIL(load_samples())) {
+    COMMON_LOG(WARN, "fail to load samples", K(ret), K(input_file_));
+  } else if (NULL != binary_file_ && OB_FAIL(symbolize())) {
+    COMMON_LOG(WARN, "fail to symbolize stacks", K(ret), K(binary_file_));
+  } else if (OB_FAIL(output_folded())) {
+    COMMON_LOG(WARN, "fail to output folded stacks", K(ret), K(output_file_));
+  }
+  return ret;
+}
+
+int ObAdminFlameGraphExecutor::load_samples()
+{
+  int ret = OB_SUCCESS;
+  std::ifstream in(input_file_);
+  if (!in.is_open()) {
+    ret = OB_FILE_NOT_EXIST;
+    COMMON_LOG(WARN, "fail to open input file", K(ret), K(input_file_));
+  } else {
+    std::string line;
+    while (std::getline(in, line)) {
+      std::vector<std::string> columns;
+      std::string column;
+      std::istringstream line_stream(line);
+      while (std::getline(line_stream, column, '\t')) {
+        columns.push_back(column);
+      }
+      if (columns.empty()) {
+        continue;
+      }
+      std::vector<std::string> key;
+      for (int64_t i = 0; i + 1 < static_cast<int64_t>(columns.size()); i++) {
+        if (!columns[i].empty() && "NULL" != columns[i]) {
+          key.push_back(columns[i]);
+        }
+      }
+      // the stack is leaf first, folded format wants root first
+      std::vector<std::string> frames;
+      std::string frame;
+      std::istringstream stack_stream(columns.back());
+      while (stack_stream >> frame) {
+        frames.push_back(frame);
+      }
+      std::reverse(frames.begin(), frames.end());
+      key.insert(key.end(), frames.begin(), frames.end());
+      if (!frames.empty()) {
+        stacks_[key]++;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObAdminFlameGraphExecutor::symbolize()
+{
+  int ret = OB_SUCCESS;
+  char addr_file[] = "/tmp/ob_admin_flamegraph_XXXXXX";
+  int fd = mkstemp(addr_file);
+  FILE *addr_fp = NULL;
+  if (fd < 0 || NULL == (addr_fp = fdopen(fd, "w"))) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fail to create temp file", K(ret), K(errno));
+  } else {
+    std::vector<std::string> addrs;
+    for (auto iter = stacks_.begin(); iter != stacks_.end(); ++iter) {
+      for (auto frame = iter->first.begin(); frame != iter->first.end(); ++frame) {
+        if (0 == frame->compare(0, 2, "0x") && symbols_.find(*frame) == symbols_.end()) {
+          symbols_[*frame] = *frame;
+          addrs.push_back(*frame);
+          fprintf(addr_fp, "%s\n", frame->c_str());
+        }
+      }
+    }
+    fclose(addr_fp);
+    FILE *out_fp = NULL;
+    pid_t pid = -1;
+    if (OB_FAIL(start_addr2line(addr_file, pid, out_fp))) {
+      COMMON_LOG(WARN, "fail to run addr2line", K(ret), K(binary_file_));
+    } else {
+      // addr2line prints function name and file:line for every address
+      char func[4096];
+      char file_line[4096];
+      for (int64_t i = 0; i < static_cast<int64_t>(addrs.size())
+           && NULL != fgets(func, sizeof(func), out_fp)
+           && NULL != fgets(file_line, sizeof(file_line), out_fp); i++) {
+        func[strcspn(func, "\n")] = '\0';
+        if ('\0' != func[0] && 0 != strcmp(func, "??")) {
+          symbols_[addrs[i]] = func;
+        }
+      }
+      fclose(out_fp);
+      int status = 0;
+      while (waitpid(pid, &status, 0) < 0 && EINTR == errno);
+      if (!WIFEXITED(status) || 0 != WEXITSTATUS(status)) {
+        // frames which are not resolved are kept as raw addresses
+        COMMON_LOG(WARN, "addr2line did not exit normally", K(status), K(binary_file_));
+      }
+    }
+  }
+  if (fd >= 0) {
+    unlink(addr_file);
+  }
+  return ret;
+}
+
+// the binary path is passed as an argument of execvp instead of a shell command line,
+// so it is never interpreted by a shell
+int ObAdminFlameGraphExecutor::start_addr2line(const char *addr_file, pid_t &pid, FILE *&out_fp)
+{
+  int ret = OB_SUCCESS;
+  int pipe_fds[2] = {-1, -1};
+  int addr_fd = -1;
+  pid = -1;
+  out_fp = NULL;
+  if (0 != pipe(pipe_fds)) {
+    ret = OB_ERR_SYS;
+    COMMON_LOG(WARN, "fail to create pipe", K(ret), K(errno));
+  } else if ((addr_fd = open(addr_file, O_RDONLY)) < 0) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fail to open address file", K(ret), K(errno), K(addr_file));
+  } else if ((pid = fork()) < 0) {
+    ret = OB_ERR_SYS;
+    COMMON_LOG(WARN, "fail to fork", K(ret), K(errno));
+  } else if (0 == pid) {
+    // child, the address file is stdin and the pipe is stdout
+    char *const argv[] = {const_cast<char *>("addr2line"), const_cast<char *>("-C"),
+                          const_cast<char *>("-f"), const_cast<char *>("-e"),
+                          const_cast<char *>(binary_file_), NULL};
+    if (dup2(addr_fd, STDIN_FILENO) < 0 || dup2(pipe_fds[1], STDOUT_FILENO) < 0) {
+      _exit(127);
+    }
+    close(addr_fd);
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+    execvp(argv[0], argv);
+    _exit(127);
+  } else if (NULL == (out_fp = fdopen(pipe_fds[0], "r"))) {
+    ret = OB_ERR_SYS;
+    COMMON_LOG(WARN, "fail to open pipe", K(ret), K(errno));
+    kill(pid, SIGKILL);
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && EINTR == errno);
+  } else {
+    pipe_fds[0] = -1;
+  }
+  if (addr_fd >= 0) {
+    close(addr_fd);
+  }
+  if (pipe_fds[0] >= 0) {
+    close(pipe_fds[0]);
+  }
+  if (pipe_fds[1] >= 0) {
+    close(pipe_fds[1]);
+  }
+  return ret;
+}
+
+const std::string &ObAdminFlameGraphExecutor::get_symbol(const std::string &addr)
+{
+  auto iter = symbols_.find(addr);
+  return iter == symbols_.end() ? addr : iter->second;
+}
+
+int ObAdminFlameGraphExecutor::output_folded()
+{
+  int ret = OB_SUCCESS;
+  FILE *out = NULL == output_file_ ? stdout : fopen(output_file_, "w");
+  if (NULL == out) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fail to open output file", K(ret), K(output_file_));
+  } else {
+    for (auto iter = stacks_.begin(); iter != stacks_.end(); ++iter) {
+      std::string folded;
+      for (auto frame = iter->first.begin(); frame != iter->first.end(); ++frame) {
+        if (!folded.empty()) {
+          folded += ";";
+        }
+        // ';' separates frames in the folded format
+        std::string name = get_symbol(*frame);
+        std::replace(name.begin(), name.end(), ';', ':');
+        folded += name;
+      }
+      fprintf(out, "%s %ld\n", folded.c_str(), iter->second);
+    }
+    if (stdout != out) {
+      fclose(out);
+    }
+  }
+  return ret;
+}
+
+int ObAdminFlameGraphExecutor::parse_cmd(int argc, char *argv[])
+{
+  int ret = OB_SUCCESS;
+  int opt = 0;
+  const char* opt_string = "hf:b:o:";
+  struct option longopts[] =
+    {{"help", 0, NULL, 'h' },
+     {"file", 1, NULL, 'f'},
+     {"binary", 1, NULL, 'b'},
+     {"output", 1, NULL, 'o'},
+     {NULL, 0, NULL, 0}};
+
+  while ((opt = getopt_long(argc, argv, opt_string, longopts, NULL)) != -1) {
+    switch (opt) {
+      case 'h': {
+        print_usage();
+        break;
+      }
+      case 'f': {
+        input_file_ = optarg;
+        break;
+      }
+      case 'b': {
+        binary_file_ = optarg;
+        break;
+      }
+      case 'o': {
+        output_file_ = optarg;
+        break;
+      }
+      default: {
+        print_usage();
+        ret = OB_INVALID_ARGUMENT;
+      }
+    }
+  }
+  return ret;
+}
+
+void ObAdminFlameGraphExecutor::print_usage()
+{
+  fprintf(stderr, "\nUsage: ob_admin flamegraph -f samples_file [-b observer_binary] [-o output_file]\n"
+          "       samples_file: tab separated rows selected from __all_virtual_cpu_profile,\n"
+          "                     the last column must be `stack`, e.g.\n"
+          "                     obclient -N -B -e \"select sql_id, stack from oceanbase.__all_virtual_cpu_profile\"\n"
+          "       observer_binary: resolve frames with addr2line, keep raw addresses if absent\n"
+          "       output is in folded format, render it with flamegraph.pl\n");
+}
+
+void ObAdminFlameGraphExecutor::reset()
+{
+  input_file_ = NULL;
+  binary_file_ = NULL;
+  output_file_ = NULL;
+  stacks_.clear();
+  symbols_.clear();
+}
+
+}
+}
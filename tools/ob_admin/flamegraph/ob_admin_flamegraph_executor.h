@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_ADMIN_FLAMEGRAPH_EXECUTOR_H_
+#define OB_ADMIN_FLAMEGRAPH_EXECUTOR_H_
+#include <stdio.h>
+#include <sys/types.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "../ob_admin_executor.h"
+
+namespace oceanbase
+{
+namespace tools
+{
+
+// Turn rows exported from __all_virtual_cpu_profile into the folded stack
+// format consumed by flamegraph.pl, e.g.
+//
+//   obclient -N -B -e "select sql_id, stack from oceanbase.__all_virtual_cpu_profile" > samples
+//   ob_admin flamegraph -f samples -b bin/observer > observer.folded
+//
+// Every row is tab separated, the last column is the stack and all columns
+// before it become the root frames, so samples can be grouped by sql_id,
+// tenant, plan line or whatever is selected.
+class ObAdminFlameGraphExecutor : public ObAdminExecutor
+{
+public:
+  ObAdminFlameGraphExecutor();
+  virtual ~ObAdminFlameGraphExecutor();
+  virtual int execute(int argc, char *argv[]);
+  void reset();
+private:
+  int parse_cmd(int argc, char *argv[]);
+  void print_usage();
+  int load_samples();
+  int symbolize();
+  // run addr2line on binary_file_ with addr_file as stdin, out_fp reads its stdout
+  int start_addr2line(const char *addr_file, pid_t &pid, FILE *&out_fp);
+  int output_folded();
+  const std::string &get_symbol(const std::string &addr);
+private:
+  const char *input_file_;
+  const char *binary_file_;
+  const char *output_file_;
+  // prefix columns and raw frames (root first) of a distinct stack -> sample count
+  std::map<std::vector<std::string>, int64_t> stacks_;
+  std::map<std::string, std::string> symbols_;
+};
+
+}
+}
+
+#endif /* OB_ADMIN_FLAMEGRAPH_EXECUTOR_H_ */
@@ -23,6 +23,7 @@
 #include "log_tool/ob_admin_log_tool_executor.h"
 #include "slog_tool/ob_admin_slog_executor.h"
 #include "dump_ckpt/ob_admin_dump_ckpt_executor.h"
+#include "flamegraph/ob_admin_flamegraph_executor.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::tools;
@@ -34,6 +35,7 @@ void print_usage()
          "       ob_admin dump_ckpt ## dump slog checkpoint, only support for 4.x\n"
          "       ob_admin dumpsst\n"
          "       ob_admin dump_enum_value\n"
+         "       ob_admin flamegraph ## fold __all_virtual_cpu_profile samples for flamegraph.pl\n"
          "       ob_admin log_tool ## './ob_admin log_tool' for more detail\n"
          "       ob_admin -h127.0.0.1 -p2883 xxx\n"
          "       ob_admin -h127.0.0.1 -p2883 (-sintl/-ssm -mbkmi/-mlocal) [command]\n"
@@ -73,6 +75,8 @@ int main(int argc, char *argv[])
       executor = new ObAdminSlogExecutor();
     } else if (0 == strcmp("dump_ckpt", argv[1])) {
       executor = new ObAdminDumpCkptExecutor();
+    } else if (0 == strcmp("flamegraph", argv[1])) {
+      executor = new ObAdminFlameGraphExecutor();
     } else if (0 == strncmp("-h", argv[1], 2) || 0 == strncmp("-S", argv[1], 2)) {
       executor = new ObAdminServerExecutor();
     } else {
@@ -136,6 +136,56 @@ TEST_F(TestHFilterParser, basic_test)
   is_equal_content(tmp_file, result_file);
 }
 
+TEST_F(TestHFilterParser, row_key_bound)
+{
+  ObArenaAllocator allocator;
+  ObHTableFilterParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(&allocator));
+  hfilter::Filter *filter = NULL;
+  {
+    hfilter::RowKeyBound bound;
+    ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(=, 'binary:abc')"), filter));
+    ASSERT_EQ(OB_SUCCESS, filter->get_row_key_bound(allocator, bound));
+    ASSERT_TRUE(bound.has_lower_ && bound.has_upper_);
+    ASSERT_TRUE(bound.lower_inclusive_ && bound.upper_inclusive_);
+    ASSERT_EQ(ObString::make_string("abc"), bound.lower_);
+    ASSERT_EQ(ObString::make_string("abc"), bound.upper_);
+  }
+  {
+    hfilter::RowKeyBound bound;
+    ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(=, 'binaryprefix:ab')"), filter));
+    ASSERT_EQ(OB_SUCCESS, filter->get_row_key_bound(allocator, bound));
+    ASSERT_TRUE(bound.has_lower_ && bound.has_upper_);
+    ASSERT_TRUE(bound.lower_inclusive_);
+    ASSERT_FALSE(bound.upper_inclusive_);
+    ASSERT_EQ(ObString::make_string("ab"), bound.lower_);
+    ASSERT_EQ(ObString::make_string("ac"), bound.upper_);
+  }
+  {
+    hfilter::RowKeyBound bound;
+    ASSERT_EQ(OB_SUCCESS, parser.parse_filter(
+        ObString::make_string("RowFilter(>, 'binary:b') AND RowFilter(<, 'binary:d') AND ValueFilter(=, 'binary:x')"), filter));
+    ASSERT_EQ(OB_SUCCESS, filter->get_row_key_bound(allocator, bound));
+    ASSERT_TRUE(bound.has_lower_ && bound.has_upper_);
+    ASSERT_FALSE(bound.lower_inclusive_);
+    ASSERT_FALSE(bound.upper_inclusive_);
+    ASSERT_EQ(ObString::make_string("b"), bound.lower_);
+    ASSERT_EQ(ObString::make_string("d"), bound.upper_);
+  }
+  {
+    // OR and NOT_EQUAL do not narrow the scan
+    hfilter::RowKeyBound bound;
+    ASSERT_EQ(OB_SUCCESS, parser.parse_filter(
+        ObString::make_string("RowFilter(=, 'binary:b') OR RowFilter(=, 'binary:d')"), filter));
+    ASSERT_EQ(OB_SUCCESS, filter->get_row_key_bound(allocator, bound));
+    ASSERT_TRUE(bound.is_unbounded());
+    ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(!=, 'binary:b')"), filter));
+    ASSERT_EQ(OB_SUCCESS, filter->get_row_key_bound(allocator, bound));
+    ASSERT_TRUE(bound.is_unbounded());
+  }
+  parser.destroy();
+}
+
 int main(int argc, char **argv)
 {
   OB_LOGGER.set_log_level("INFO");
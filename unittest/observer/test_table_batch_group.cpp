@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "observer/table/ob_table_batch_execute_processor.h"
+#undef private
+
+using namespace oceanbase::common;
+using namespace oceanbase::table;
+using namespace oceanbase::observer;
+
+class TestTableBatchGroup : public ::testing::Test
+{
+public:
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  static const int64_t OP_COUNT = 7;
+  // operation i has rowkey i, it is a get on even rows and an insert on odd rows
+  void build_batch(ObTableBatchOperation &batch)
+  {
+    for (int64_t i = 0; i < OP_COUNT; ++i) {
+      ObObj key;
+      key.set_int(i);
+      ASSERT_EQ(OB_SUCCESS, entities_[i].add_rowkey_value(key));
+      if (0 == i % 2) {
+        ASSERT_EQ(OB_SUCCESS, batch.retrieve(entities_[i]));
+      } else {
+        ASSERT_EQ(OB_SUCCESS, batch.insert(entities_[i]));
+      }
+    }
+  }
+  int64_t rowkey_of(const ObTableOperation &op)
+  {
+    ObObj key;
+    EXPECT_EQ(OB_SUCCESS, op.entity().get_rowkey_value(0, key));
+    return key.get_int();
+  }
+  ObTableEntity entities_[OP_COUNT];
+};
+
+TEST_F(TestTableBatchGroup, group_by_tablet)
+{
+  ObTableBatchOperation batch;
+  build_batch(batch);
+  const ObTabletID t1(200001);
+  const ObTabletID t2(200002);
+  const ObTabletID t3(200003);
+  ObSEArray<ObTabletID, OP_COUNT> op_tablet_ids;
+  const ObTabletID tablet_of_op[OP_COUNT] = {t2, t1, t2, t3, t1, t1, t2};
+  for (int64_t i = 0; i < OP_COUNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, op_tablet_ids.push_back(tablet_of_op[i]));
+  }
+
+  // every operation lands in exactly one group, in request order
+  const ObTabletID tablets[] = {t1, t2, t3};
+  const int64_t expect_idxs[][OP_COUNT] = {{1, 4, 5}, {0, 2, 6}, {3}};
+  const int64_t expect_cnts[] = {3, 3, 1};
+  int64_t total = 0;
+  for (int64_t g = 0; g < 3; ++g) {
+    ObTableBatchOperation group_ops;
+    ObSEArray<int64_t, OP_COUNT> op_idxs;
+    ASSERT_EQ(OB_SUCCESS, ObTableBatchExecuteP::build_tablet_group(
+        batch, tablets[g], op_tablet_ids, group_ops, op_idxs));
+    ASSERT_EQ(expect_cnts[g], op_idxs.count());
+    ASSERT_EQ(expect_cnts[g], group_ops.count());
+    for (int64_t i = 0; i < op_idxs.count(); ++i) {
+      const int64_t op_idx = op_idxs.at(i);
+      EXPECT_EQ(expect_idxs[g][i], op_idx);
+      EXPECT_EQ(op_idx, rowkey_of(group_ops.at(i)));
+      EXPECT_EQ(batch.at(op_idx).type(), group_ops.at(i).type());
+    }
+    total += op_idxs.count();
+  }
+  EXPECT_EQ(OP_COUNT, total);
+}
+
+TEST_F(TestTableBatchGroup, readonly_group)
+{
+  ObTableBatchOperation batch;
+  build_batch(batch);
+  EXPECT_FALSE(batch.is_readonly());
+  // gets only on the even tablet
+  ObSEArray<ObTabletID, OP_COUNT> op_tablet_ids;
+  for (int64_t i = 0; i < OP_COUNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, op_tablet_ids.push_back(ObTabletID(0 == i % 2 ? 200002 : 200001)));
+  }
+  ObTableBatchOperation get_ops;
+  ObTableBatchOperation write_ops;
+  ObSEArray<int64_t, OP_COUNT> get_idxs;
+  ObSEArray<int64_t, OP_COUNT> write_idxs;
+  ASSERT_EQ(OB_SUCCESS, ObTableBatchExecuteP::build_tablet_group(
+      batch, ObTabletID(200002), op_tablet_ids, get_ops, get_idxs));
+  ASSERT_EQ(OB_SUCCESS, ObTableBatchExecuteP::build_tablet_group(
+      batch, ObTabletID(200001), op_tablet_ids, write_ops, write_idxs));
+  EXPECT_TRUE(get_ops.is_readonly());
+  EXPECT_FALSE(write_ops.is_readonly());
+  EXPECT_EQ(4, get_idxs.count());
+  EXPECT_EQ(3, write_idxs.count());
+}
+
+TEST_F(TestTableBatchGroup, no_match_and_mismatch)
+{
+  ObTableBatchOperation batch;
+  build_batch(batch);
+  ObSEArray<ObTabletID, OP_COUNT> op_tablet_ids;
+  for (int64_t i = 0; i < OP_COUNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, op_tablet_ids.push_back(ObTabletID(200001)));
+  }
+  ObTableBatchOperation group_ops;
+  ObSEArray<int64_t, OP_COUNT> op_idxs;
+  ASSERT_EQ(OB_SUCCESS, ObTableBatchExecuteP::build_tablet_group(
+      batch, ObTabletID(200002), op_tablet_ids, group_ops, op_idxs));
+  EXPECT_EQ(0, group_ops.count());
+  EXPECT_EQ(0, op_idxs.count());
+
+  // one tablet per operation is required
+  op_tablet_ids.pop_back();
+  EXPECT_EQ(OB_INVALID_ARGUMENT, ObTableBatchExecuteP::build_tablet_group(
+      batch, ObTabletID(200001), op_tablet_ids, group_ops, op_idxs));
+}
+
+TEST_F(TestTableBatchGroup, check_batch_leaders)
+{
+  const ObAddr self(ObAddr::IPV4, "127.0.0.1", 2882);
+  const ObAddr other(ObAddr::IPV4, "127.0.0.2", 2882);
+  const ObAddr third(ObAddr::IPV4, "127.0.0.3", 2882);
+  ObSEArray<ObAddr, 4> leaders;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, ObTableBatchExecuteP::check_batch_leaders(leaders, self));
+
+  // every tablet is local
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(self));
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(self));
+  EXPECT_EQ(OB_SUCCESS, ObTableBatchExecuteP::check_batch_leaders(leaders, self));
+
+  // one remote server leads every tablet, the client can reroute the whole batch
+  leaders.reuse();
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(other));
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(other));
+  EXPECT_EQ(OB_NOT_MASTER, ObTableBatchExecuteP::check_batch_leaders(leaders, self));
+
+  // no single server leads every tablet, rerouting would never succeed
+  leaders.reuse();
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(self));
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(other));
+  EXPECT_EQ(OB_NOT_SUPPORTED, ObTableBatchExecuteP::check_batch_leaders(leaders, self));
+  leaders.reuse();
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(other));
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(other));
+  ASSERT_EQ(OB_SUCCESS, leaders.push_back(third));
+  EXPECT_EQ(OB_NOT_SUPPORTED, ObTableBatchExecuteP::check_batch_leaders(leaders, self));
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "share/allocator/ob_fifo_arena.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+namespace unittest
+{
+class TestFifoArenaThrottle : public ::testing::Test
+{
+public:
+  static const int64_t MB = 1024 * 1024;
+  static const int64_t SECOND = 1000 * 1000;
+  // alloc and reclaim rates in bytes per second
+  void set_rates(const int64_t alloc_rate, const int64_t reclaim_rate)
+  {
+    arena_.rate_model_.alloc_rate_ = alloc_rate;
+    arena_.rate_model_.reclaim_rate_ = reclaim_rate;
+  }
+  int64_t interval(const int64_t cur_mem_hold, const int64_t horizon)
+  {
+    return arena_.get_predictive_throttling_interval(cur_mem_hold, ALLOC_SIZE, TRIGGER, horizon);
+  }
+  static const int64_t ALLOC_SIZE = 2 * MB;
+  static const int64_t TRIGGER = 1024 * MB;
+  allocator::ObFifoArena arena_;
+};
+
+TEST_F(TestFifoArenaThrottle, rate_model)
+{
+  allocator::ObFifoArena::ObWriteRateModel model;
+  const int64_t step = allocator::ObFifoArena::ObWriteRateModel::SAMPLE_INTERVAL;
+  int64_t ts = 10 * SECOND;
+  // the first sample only sets the base
+  model.update(ts, 0, 0);
+  EXPECT_EQ(0, model.get_alloc_rate());
+  // samples closer than SAMPLE_INTERVAL are ignored
+  model.update(ts + step - 1, 100 * MB, 0);
+  EXPECT_EQ(0, model.get_alloc_rate());
+
+  // steady 100MB/s allocated and 10MB/s reclaimed converges to those rates
+  int64_t allocated = 0;
+  int64_t reclaimed = 0;
+  for (int64_t i = 0; i < 100; i++) {
+    ts += step;
+    allocated += 100 * MB * step / SECOND;
+    reclaimed += 10 * MB * step / SECOND;
+    model.update(ts, allocated, reclaimed);
+  }
+  EXPECT_NEAR(100 * MB, model.get_alloc_rate(), MB);
+  EXPECT_NEAR(10 * MB, model.get_reclaim_rate(), MB);
+
+  // a stall decays the rates instead of dropping them at once
+  ts += step;
+  model.update(ts, allocated, reclaimed);
+  const int64_t decayed = model.get_alloc_rate();
+  EXPECT_LT(decayed, 100 * MB);
+  EXPECT_GT(decayed, 50 * MB);
+  model.reset();
+  EXPECT_EQ(0, model.get_alloc_rate());
+  EXPECT_EQ(0, model.get_reclaim_rate());
+}
+
+TEST_F(TestFifoArenaThrottle, horizon_zero)
+{
+  // the default horizon turns the predictive path off, only the trigger throttles
+  EXPECT_EQ(0, allocator::ObFifoArena::DEFAULT_PREDICTIVE_HORIZON);
+  set_rates(1000 * MB, 0);
+  EXPECT_EQ(0, interval(TRIGGER - MB, 0));
+  EXPECT_EQ(0, interval(TRIGGER / 2, 0));
+}
+
+TEST_F(TestFifoArenaThrottle, no_throttle)
+{
+  const int64_t horizon = 10 * SECOND;
+  // reclaim keeps up with writers
+  set_rates(100 * MB, 100 * MB);
+  EXPECT_EQ(0, interval(TRIGGER - MB, horizon));
+  set_rates(100 * MB, 200 * MB);
+  EXPECT_EQ(0, interval(TRIGGER - MB, horizon));
+  // the trigger is farther than the horizon: 1000MB at 50MB/s is 20s
+  set_rates(60 * MB, 10 * MB);
+  EXPECT_EQ(0, interval(TRIGGER - 1000 * MB, horizon));
+  // above the trigger the cubic throttle takes over
+  EXPECT_EQ(0, interval(TRIGGER, horizon));
+  EXPECT_EQ(0, interval(TRIGGER + MB, horizon));
+}
+
+TEST_F(TestFifoArenaThrottle, zero_reclaim_rate)
+{
+  const int64_t horizon = 10 * SECOND;
+  set_rates(100 * MB, 0);
+  // writers are paced to headroom / horizon: 100MB over 10s is 10MB/s, 2MB every 200ms,
+  // capped to MAX_PREDICTIVE_INTERVAL
+  const int64_t max_interval = allocator::ObFifoArena::MAX_PREDICTIVE_INTERVAL;
+  EXPECT_EQ(max_interval, interval(TRIGGER - 100 * MB, horizon));
+  // nothing reclaimed and one byte of headroom, no division by zero and no endless stall
+  EXPECT_EQ(max_interval, interval(TRIGGER - 1, horizon));
+  // fast writers with a large headroom stay below the cap: 900MB over 5s is 180MB/s,
+  // 2MB every ~11ms
+  set_rates(1000 * MB, 0);
+  const int64_t far = interval(TRIGGER - 900 * MB, 5 * SECOND);
+  EXPECT_GT(far, 0);
+  EXPECT_LT(far, max_interval);
+}
+
+TEST_F(TestFifoArenaThrottle, grows_with_shrinking_headroom)
+{
+  const int64_t horizon = 60 * SECOND;
+  // 400MB/s allocated, 100MB/s reclaimed, the trigger is within the horizon below ~18GB
+  set_rates(400 * MB, 100 * MB);
+  int64_t last = 0;
+  for (int64_t headroom = 1000 * MB; headroom > 0; headroom -= 100 * MB) {
+    const int64_t cur = interval(TRIGGER - headroom, horizon);
+    EXPECT_GT(cur, 0) << headroom;
+    EXPECT_GE(cur, last) << headroom;
+    last = cur;
+  }
+  // paced to the reclaim rate right below the trigger: 2MB at 100MB/s is 20ms
+  EXPECT_NEAR(ALLOC_SIZE * SECOND / (100 * MB), interval(TRIGGER - 1, horizon), 100);
+  // and to reclaim + headroom / horizon farther away: 100MB/s + 1000MB / 60s
+  const int64_t expect = static_cast<int64_t>(
+      static_cast<double>(ALLOC_SIZE) * SECOND / (100.0 * MB + 1000.0 * MB / 60));
+  EXPECT_NEAR(expect, interval(TRIGGER - 1000 * MB, horizon), 100);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
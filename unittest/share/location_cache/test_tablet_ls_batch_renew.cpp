@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SHARE
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#define private public
+#include "share/location_cache/ob_tablet_ls_service.h"
+#undef private
+#include "share/mock_mysql_proxy.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace share;
+using ::testing::_;
+using ::testing::Invoke;
+
+// inner sql is never answered with rows here, every read fails with ret_
+class SqlRecorder
+{
+public:
+  SqlRecorder() : ret_(OB_ERR_UNEXPECTED) {}
+  int read(ObMySQLProxy::ReadResult &res, const uint64_t tenant_id, const char *sql)
+  {
+    UNUSED(res);
+    UNUSED(tenant_id);
+    sqls_.push_back(std::string(sql));
+    return ret_;
+  }
+  int64_t sql_count() const { return static_cast<int64_t>(sqls_.size()); }
+  bool is_batch(const int64_t idx) const
+  {
+    return std::string::npos != sqls_.at(idx).find("IN (");
+  }
+  int ret_;
+  std::vector<std::string> sqls_;
+};
+
+class TestTabletLSBatchRenew : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, service_.inner_cache_.init());
+    service_.sql_proxy_ = &sql_proxy_;
+    service_.inited_ = true;
+    ON_CALL(sql_proxy_, read(_, _, _))
+        .WillByDefault(Invoke(&recorder_, &SqlRecorder::read));
+  }
+  virtual void TearDown()
+  {
+    service_.inited_ = false;
+    service_.sql_proxy_ = NULL;
+    service_.inner_cache_.destroy();
+  }
+protected:
+  static const uint64_t TENANT_ID = 1002;
+  void build_tablet_ids(const int64_t count, ObIArray<ObTabletID> &tablet_ids)
+  {
+    for (int64_t i = 0; i < count; ++i) {
+      ASSERT_EQ(OB_SUCCESS, tablet_ids.push_back(ObTabletID(200001 + i)));
+    }
+  }
+  void put_cache(const ObTabletID &tablet_id, const int64_t renew_time)
+  {
+    ObTabletLSCache tablet_cache;
+    ASSERT_EQ(OB_SUCCESS, tablet_cache.init(TENANT_ID, tablet_id, ObLSID(1001), renew_time, 1));
+    ASSERT_EQ(OB_SUCCESS, service_.update_cache_(tablet_cache));
+  }
+  ::testing::NiceMock<MockMySQLProxy> sql_proxy_;
+  SqlRecorder recorder_;
+  ObTabletLSService service_;
+};
+
+TEST_F(TestTabletLSBatchRenew, inner_batch_get_by_sql)
+{
+  ObSEArray<ObTabletID, 8> tablet_ids;
+  ObSEArray<ObTabletLSCache, 8> tablet_caches;
+  build_tablet_ids(5, tablet_ids);
+
+  // only [start_idx, end_idx) goes into the in-list
+  EXPECT_EQ(OB_ERR_UNEXPECTED, service_.inner_batch_get_by_sql_(
+      TENANT_ID, tablet_ids, 1, 4, tablet_caches));
+  ASSERT_EQ(1, recorder_.sql_count());
+  EXPECT_STREQ("SELECT tablet_id, ls_id, ORA_ROWSCN from __all_tablet_to_ls "
+               "WHERE tablet_id IN (200002, 200003, 200004)", recorder_.sqls_.at(0).c_str());
+  EXPECT_EQ(0, tablet_caches.count());
+
+  recorder_.ret_ = OB_SUCCESS;
+  // no result set
+  EXPECT_EQ(OB_ERR_UNEXPECTED, service_.inner_batch_get_by_sql_(
+      TENANT_ID, tablet_ids, 4, 5, tablet_caches));
+  ASSERT_EQ(2, recorder_.sql_count());
+  EXPECT_STREQ("SELECT tablet_id, ls_id, ORA_ROWSCN from __all_tablet_to_ls "
+               "WHERE tablet_id IN (200005)", recorder_.sqls_.at(1).c_str());
+
+  // invalid ranges never reach sql
+  EXPECT_EQ(OB_INVALID_ARGUMENT, service_.inner_batch_get_by_sql_(
+      TENANT_ID, tablet_ids, 2, 2, tablet_caches));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, service_.inner_batch_get_by_sql_(
+      TENANT_ID, tablet_ids, -1, 2, tablet_caches));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, service_.inner_batch_get_by_sql_(
+      TENANT_ID, tablet_ids, 0, 6, tablet_caches));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, service_.inner_batch_get_by_sql_(
+      OB_INVALID_TENANT_ID, tablet_ids, 0, 1, tablet_caches));
+  EXPECT_EQ(2, recorder_.sql_count());
+}
+
+TEST_F(TestTabletLSBatchRenew, batch_renew_cache)
+{
+  ObSEArray<ObTabletID, 8> tablet_ids;
+  build_tablet_ids(service_.BATCH_RENEW_TABLET_COUNT + 1, tablet_ids);
+
+  // a chunk is at most BATCH_RENEW_TABLET_COUNT tablets
+  EXPECT_EQ(OB_INVALID_ARGUMENT, service_.batch_renew_cache_(
+      TENANT_ID, tablet_ids, 0, tablet_ids.count()));
+  EXPECT_EQ(0, recorder_.sql_count());
+
+  EXPECT_EQ(OB_ERR_UNEXPECTED, service_.batch_renew_cache_(
+      TENANT_ID, tablet_ids, 1, tablet_ids.count()));
+  ASSERT_EQ(1, recorder_.sql_count());
+  EXPECT_TRUE(recorder_.is_batch(0));
+  EXPECT_EQ(std::string::npos, recorder_.sqls_.at(0).find("200001,"));
+  EXPECT_NE(std::string::npos, recorder_.sqls_.at(0).find("200201)"));
+
+  // sql timeout is reported as location timeout like single tablet renew
+  recorder_.ret_ = OB_TIMEOUT;
+  EXPECT_EQ(OB_GET_LOCATION_TIME_OUT, service_.batch_renew_cache_(
+      TENANT_ID, tablet_ids, 0, 2));
+}
+
+TEST_F(TestTabletLSBatchRenew, renew_tablets_fallback)
+{
+  const int64_t batch = service_.BATCH_RENEW_TABLET_COUNT;
+  const int64_t count = 2 * batch + 50;
+  ObSEArray<ObTabletID, 8> tablet_ids;
+  build_tablet_ids(count, tablet_ids);
+
+  // every chunk fails, its tablets are renewed one by one before the next chunk
+  EXPECT_NE(OB_SUCCESS, service_.renew_tablets_(TENANT_ID, tablet_ids));
+  ASSERT_EQ(3 + count, recorder_.sql_count());
+  int64_t idx = 0;
+  for (int64_t start_idx = 0; start_idx < count; start_idx += batch) {
+    const int64_t end_idx = std::min(start_idx + batch, count);
+    ASSERT_TRUE(recorder_.is_batch(idx)) << idx;
+    ++idx;
+    for (int64_t i = start_idx; i < end_idx; ++i, ++idx) {
+      ASSERT_FALSE(recorder_.is_batch(idx)) << idx;
+      char expect[64];
+      snprintf(expect, sizeof(expect), "tablet_id = %lu", tablet_ids.at(i).id());
+      EXPECT_NE(std::string::npos, recorder_.sqls_.at(idx).find(expect)) << idx;
+    }
+  }
+
+  // nothing to renew
+  tablet_ids.reset();
+  recorder_.sqls_.clear();
+  EXPECT_EQ(OB_SUCCESS, service_.renew_tablets_(TENANT_ID, tablet_ids));
+  EXPECT_EQ(0, recorder_.sql_count());
+}
+
+TEST_F(TestTabletLSBatchRenew, prefetch)
+{
+  const int64_t now = ObTimeUtility::current_time();
+  const int64_t expire_renew_time = now - 2 * 1000000;
+  ObSEArray<ObTabletID, 8> tablet_ids;
+  build_tablet_ids(4, tablet_ids);
+  put_cache(tablet_ids.at(0), now);
+  put_cache(tablet_ids.at(1), now);
+  put_cache(tablet_ids.at(2), now);
+
+  // a single miss is left for get()
+  EXPECT_EQ(OB_SUCCESS, service_.prefetch(TENANT_ID, tablet_ids, expire_renew_time));
+  EXPECT_EQ(0, recorder_.sql_count());
+
+  // missing and expired tablets are renewed together, fresh ones are skipped
+  put_cache(tablet_ids.at(1), expire_renew_time - 1);
+  EXPECT_EQ(OB_ERR_UNEXPECTED, service_.prefetch(TENANT_ID, tablet_ids, expire_renew_time));
+  ASSERT_EQ(1, recorder_.sql_count());
+  EXPECT_NE(std::string::npos, recorder_.sqls_.at(0).find("IN (200002, 200004)"));
+
+  // sys tenant is not kept in __all_tablet_to_ls
+  recorder_.sqls_.clear();
+  EXPECT_EQ(OB_SUCCESS, service_.prefetch(OB_SYS_TENANT_ID, tablet_ids, expire_renew_time));
+  EXPECT_EQ(0, recorder_.sql_count());
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
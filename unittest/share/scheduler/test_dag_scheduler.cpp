@@ -1292,6 +1292,43 @@ TEST_F(TestDagScheduler, test_set_concurrency)
   wait_scheduler();
 }
 
+TEST_F(TestDagScheduler, test_user_io_rt_baseline)
+{
+  double baseline = 0;
+  // no user read, baseline is not set
+  EXPECT_FALSE(ObTenantDagScheduler::check_user_io_busy(0, false, baseline));
+  EXPECT_EQ(0, baseline);
+  // first sample becomes the baseline
+  EXPECT_FALSE(ObTenantDagScheduler::check_user_io_busy(2000, false, baseline));
+  EXPECT_EQ(2000, baseline);
+  EXPECT_FALSE(ObTenantDagScheduler::check_user_io_busy(2000, false, baseline));
+  EXPECT_EQ(2000, baseline);
+  // latency lower than MIN_BUSY_USER_IO_RT_US is never busy
+  double low_baseline = 100;
+  EXPECT_FALSE(ObTenantDagScheduler::check_user_io_busy(900, false, low_baseline));
+
+  // latency spike
+  EXPECT_TRUE(ObTenantDagScheduler::check_user_io_busy(20000, false, baseline));
+  EXPECT_LT(baseline, 20000 / ObTenantDagScheduler::BUSY_USER_IO_RT_RATIO);
+  EXPECT_GT(baseline, 2000);
+
+  // a lasting higher latency level releases the clamp in bounded time
+  int64_t busy_seconds = 1;
+  while (ObTenantDagScheduler::check_user_io_busy(20000, false, baseline)) {
+    ++busy_seconds;
+    ASSERT_LT(busy_seconds, 10 * ObTenantDagScheduler::BUSY_USER_IO_RT_BASELINE_WEIGHT);
+  }
+  EXPECT_GE(baseline * ObTenantDagScheduler::BUSY_USER_IO_RT_RATIO, 20000);
+
+  // baseline follows slowly when other signals are busy
+  double busy_baseline = 2000;
+  double idle_baseline = 2000;
+  EXPECT_FALSE(ObTenantDagScheduler::check_user_io_busy(3000, true, busy_baseline));
+  EXPECT_FALSE(ObTenantDagScheduler::check_user_io_busy(3000, false, idle_baseline));
+  EXPECT_GT(busy_baseline, 2000);
+  EXPECT_LT(busy_baseline, idle_baseline);
+}
+
 TEST_F(TestDagScheduler, stress_test)
 {
   ObTenantDagScheduler *scheduler = MTL(ObTenantDagScheduler*);
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#include "share/rpc/ob_batch_rpc.h"
+#undef private
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace obrpc;
+
+class TestBatchRpc : public ::testing::Test
+{
+public:
+  static const int64_t SHORT_WAIT_US = 10 * 1000;
+  static const int64_t LONG_WAIT_US = 5 * 1000 * 1000;
+};
+
+TEST_F(TestBatchRpc, signal_before_wait)
+{
+  SingleWaitCond cond;
+  ASSERT_FALSE(cond.wait(SHORT_WAIT_US));
+  // several signals before the wait are reported once
+  cond.signal();
+  cond.signal();
+  ASSERT_TRUE(cond.wait(LONG_WAIT_US));
+  ASSERT_FALSE(cond.wait(SHORT_WAIT_US));
+}
+
+TEST_F(TestBatchRpc, signal_during_wait)
+{
+  SingleWaitCond cond;
+  int64_t wait_cost = 0;
+  bool is_signaled = false;
+  std::thread waiter([&]() {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    is_signaled = cond.wait(LONG_WAIT_US);
+    wait_cost = ObTimeUtility::current_time() - start_ts;
+  });
+  while (0 == ATOMIC_LOAD(&cond.n_waiters_)) {
+    ob_usleep(100);
+  }
+  cond.signal();
+  waiter.join();
+  // the signal wakes the waiter and is reported by this wait only
+  ASSERT_TRUE(is_signaled);
+  ASSERT_LT(wait_cost, LONG_WAIT_US);
+  ASSERT_FALSE(cond.wait(SHORT_WAIT_US));
+}
+
+// the poster publishes a sequence then signals, the sender waits and reads it,
+// as ObBatchRpcBase::do_work does with the ring buffers. Every post must be seen
+// after a wait that reports a signal, no wait may time out while posts are pending.
+TEST_F(TestBatchRpc, no_lost_signal)
+{
+  static const int64_t POST_COUNT = 100000;
+  SingleWaitCond cond;
+  int64_t posted = 0;
+  int64_t signaled_wait_count = 0;
+  std::thread poster([&]() {
+    for (int64_t i = 1; i <= POST_COUNT; ++i) {
+      ATOMIC_STORE(&posted, i);
+      cond.signal();
+    }
+  });
+  int64_t seen = 0;
+  while (seen < POST_COUNT) {
+    if (cond.wait(LONG_WAIT_US)) {
+      ++signaled_wait_count;
+    } else if (ATOMIC_LOAD(&posted) > seen) {
+      // timed out with a post published before its signal
+      break;
+    }
+    seen = ATOMIC_LOAD(&posted);
+  }
+  poster.join();
+  ASSERT_EQ(POST_COUNT, seen);
+  ASSERT_LE(signaled_wait_count, POST_COUNT);
+  // the last signal was consumed by the loop, nothing left behind
+  ASSERT_FALSE(cond.wait(SHORT_WAIT_US));
+}
+
+TEST_F(TestBatchRpc, coalesce_wait)
+{
+  const int64_t window = 200;
+  // window 0 sends right away as before, whatever the batch type
+  for (int batch_type = 0; batch_type < BATCH_REQ_TYPE_COUNT; ++batch_type) {
+    ASSERT_EQ(0, get_batch_coalesce_wait_us(batch_type, true, 0));
+    ASSERT_EQ(0, get_batch_coalesce_wait_us(batch_type, false, 0));
+  }
+  // only a wakeup of a coalescable sender is held
+  ASSERT_EQ(window, get_batch_coalesce_wait_us(TRX_BATCH_REQ_NODELAY, true, window));
+  ASSERT_EQ(window, get_batch_coalesce_wait_us(SQL_BATCH_REQ_NODELAY1, true, window));
+  ASSERT_EQ(window, get_batch_coalesce_wait_us(SQL_BATCH_REQ_NODELAY2, true, window));
+  ASSERT_EQ(0, get_batch_coalesce_wait_us(TRX_BATCH_REQ_NODELAY, false, window));
+  ASSERT_EQ(0, get_batch_coalesce_wait_us(CLOG_BATCH_REQ_NODELAY, true, window));
+  ASSERT_EQ(0, get_batch_coalesce_wait_us(CLOG_BATCH_REQ_NODELAY2, true, window));
+  ASSERT_EQ(0, get_batch_coalesce_wait_us(ELECTION_BATCH_REQ, true, window));
+  ASSERT_EQ(0, get_batch_coalesce_wait_us(BATCH_REQ_TYPE_COUNT, true, window));
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "share/ash/ob_cpu_profiler.h"
+#undef private
+#include "lib/ash/ob_active_session_guard.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace share
+{
+using namespace common;
+
+class TestCpuProfiler : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, profiler_.list_.prepare_allocate(RING_SIZE));
+  }
+  virtual void TearDown()
+  {
+    ActiveSessionStat &stat = ObActiveSessionGuard::get_stat();
+    stat.tenant_id_ = 0;
+    stat.session_id_ = 0;
+    stat.plan_id_ = 0;
+    stat.plan_line_id_ = -1;
+    stat.event_no_ = 0;
+    stat.sql_id_[0] = '\0';
+  }
+protected:
+  static const int64_t RING_SIZE = 8;
+  ObCpuProfiler profiler_;
+};
+
+TEST_F(TestCpuProfiler, ring_buffer)
+{
+  ObCpuProfileSample sample;
+  EXPECT_EQ(0, profiler_.write_pos());
+  EXPECT_FALSE(profiler_.get(0, sample));
+
+  for (int64_t i = 0; i < RING_SIZE / 2; i++) {
+    profiler_.record_sample();
+  }
+  EXPECT_EQ(RING_SIZE / 2, profiler_.write_pos());
+  for (int64_t i = 0; i < RING_SIZE / 2; i++) {
+    ASSERT_TRUE(profiler_.get(i, sample));
+    EXPECT_EQ(i + 1, sample.seq_);
+    EXPECT_EQ(GETTID(), sample.tid_);
+  }
+  // not written yet
+  EXPECT_FALSE(profiler_.get(RING_SIZE / 2, sample));
+  EXPECT_FALSE(profiler_.get(-1, sample));
+
+  // wrap around, the oldest samples are overwritten
+  for (int64_t i = 0; i < RING_SIZE; i++) {
+    profiler_.record_sample();
+  }
+  const int64_t write_pos = profiler_.write_pos();
+  EXPECT_EQ(RING_SIZE + RING_SIZE / 2, write_pos);
+  for (int64_t i = 0; i < write_pos - RING_SIZE; i++) {
+    EXPECT_FALSE(profiler_.get(i, sample));
+  }
+  for (int64_t i = write_pos - RING_SIZE; i < write_pos; i++) {
+    ASSERT_TRUE(profiler_.get(i, sample));
+    EXPECT_EQ(i + 1, sample.seq_);
+  }
+
+  // a slot being written is skipped by readers
+  ObCpuProfileSample &slot = profiler_.list_[(write_pos - 1) % RING_SIZE];
+  ATOMIC_STORE(&slot.seq_, 0);
+  EXPECT_FALSE(profiler_.get(write_pos - 1, sample));
+  EXPECT_TRUE(profiler_.get(write_pos - 2, sample));
+}
+
+TEST_F(TestCpuProfiler, ash_tag)
+{
+  ActiveSessionStat &stat = ObActiveSessionGuard::get_stat();
+  stat.tenant_id_ = 1002;
+  stat.session_id_ = 3221487617;
+  stat.plan_id_ = 17;
+  stat.plan_line_id_ = 3;
+  stat.event_no_ = 5;
+  STRNCPY(stat.sql_id_, "ABCDEF0123456789ABCDEF0123456789", sizeof(stat.sql_id_));
+  stat.sql_id_[sizeof(stat.sql_id_) - 1] = '\0';
+  profiler_.record_sample();
+
+  ObCpuProfileSample sample;
+  ASSERT_TRUE(profiler_.get(0, sample));
+  EXPECT_EQ(1002UL, sample.tenant_id_);
+  EXPECT_EQ(3221487617UL, sample.session_id_);
+  EXPECT_EQ(17UL, sample.plan_id_);
+  EXPECT_EQ(3, sample.plan_line_id_);
+  EXPECT_EQ(5, sample.event_no_);
+  EXPECT_STREQ(stat.sql_id_, sample.sql_id_);
+  EXPECT_LE(0, sample.depth_);
+  EXPECT_GE(ObCpuProfileSample::MAX_STACK_DEPTH, sample.depth_);
+}
+
+TEST(TestCpuProfilerSampling, sigprof)
+{
+  ObCpuProfiler &profiler = ObCpuProfiler::get_instance();
+  profiler.set_sample_interval(1000);
+  ASSERT_EQ(OB_SUCCESS, profiler.init());
+  EXPECT_EQ(OB_INIT_TWICE, profiler.init());
+
+  // burn about 200ms of cpu, ITIMER_PROF only ticks while the process runs
+  const int64_t start = ObTimeUtility::current_time();
+  volatile int64_t sum = 0;
+  while (ObTimeUtility::current_time() - start < 200 * 1000) {
+    for (int64_t i = 0; i < 10000; i++) {
+      sum += i;
+    }
+  }
+  profiler.set_sample_interval(0);
+  const int64_t write_pos = profiler.write_pos();
+  EXPECT_LT(0, write_pos);
+
+  // sampling is stopped, the samples taken are all readable
+  int64_t valid_cnt = 0;
+  ObCpuProfileSample sample;
+  for (int64_t pos = 0; pos < write_pos; pos++) {
+    if (profiler.get(pos, sample)) {
+      valid_cnt++;
+      EXPECT_EQ(pos + 1, sample.seq_);
+    }
+  }
+  EXPECT_EQ(write_pos, valid_cnt);
+  EXPECT_EQ(write_pos, profiler.write_pos());
+  profiler.destroy();
+}
+
+} // end namespace share
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
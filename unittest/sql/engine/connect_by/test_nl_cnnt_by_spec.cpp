@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "sql/engine/connect_by/ob_nl_cnnt_by_op.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+// ObNLConnectBySpec as serialized before the hash exprs were added
+class OldNLConnectBySpec : public ObNLConnectBySpecBase
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  OldNLConnectBySpec(ObIAllocator &alloc, const ObPhyOperatorType type)
+    : ObNLConnectBySpecBase(alloc, type) {}
+};
+
+OB_SERIALIZE_MEMBER((OldNLConnectBySpec, ObNLConnectBySpecBase));
+
+class TestNLConnectBySpec : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, exprs_.prepare_allocate(EXPR_CNT));
+    ObExpr::get_serialize_array() = &exprs_;
+  }
+  virtual void TearDown()
+  {
+    ObExpr::get_serialize_array() = NULL;
+  }
+protected:
+  static const int64_t EXPR_CNT = 8;
+  // set some members of the base spec, to check the hash exprs do not shift them
+  void fill_spec(ObNLConnectBySpecBase &spec)
+  {
+    spec.id_ = 7;
+    spec.is_nocycle_ = true;
+    spec.has_prior_ = true;
+    spec.level_expr_ = &exprs_.at(0);
+    ASSERT_EQ(OB_SUCCESS, spec.cond_exprs_.init(1));
+    ASSERT_EQ(OB_SUCCESS, spec.cond_exprs_.push_back(&exprs_.at(5)));
+  }
+  void check_base(const ObNLConnectBySpecBase &spec)
+  {
+    EXPECT_EQ(7U, spec.id_);
+    EXPECT_TRUE(spec.is_nocycle_);
+    EXPECT_TRUE(spec.has_prior_);
+    EXPECT_EQ(&exprs_.at(0), spec.level_expr_);
+    ASSERT_EQ(1, spec.cond_exprs_.count());
+    EXPECT_EQ(&exprs_.at(5), spec.cond_exprs_.at(0));
+  }
+  ObArenaAllocator alloc_;
+  ObArray<ObExpr> exprs_;
+  char buf_[4096];
+};
+
+TEST_F(TestNLConnectBySpec, hash_exprs)
+{
+  ObNLConnectBySpec spec(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  fill_spec(spec);
+  ASSERT_EQ(OB_SUCCESS, spec.hash_key_exprs_.init(2));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_key_exprs_.push_back(&exprs_.at(1)));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_key_exprs_.push_back(&exprs_.at(3)));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_probe_exprs_.init(2));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_probe_exprs_.push_back(&exprs_.at(2)));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_probe_exprs_.push_back(&exprs_.at(4)));
+
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, spec.serialize(buf_, sizeof(buf_), pos));
+  EXPECT_EQ(spec.get_serialize_size(), pos);
+
+  ObNLConnectBySpec decoded(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  const int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, decoded.deserialize(buf_, data_len, pos));
+  EXPECT_EQ(data_len, pos);
+  check_base(decoded);
+  ASSERT_EQ(2, decoded.hash_key_exprs_.count());
+  ASSERT_EQ(2, decoded.hash_probe_exprs_.count());
+  EXPECT_EQ(&exprs_.at(1), decoded.hash_key_exprs_.at(0));
+  EXPECT_EQ(&exprs_.at(3), decoded.hash_key_exprs_.at(1));
+  EXPECT_EQ(&exprs_.at(2), decoded.hash_probe_exprs_.at(0));
+  EXPECT_EQ(&exprs_.at(4), decoded.hash_probe_exprs_.at(1));
+}
+
+TEST_F(TestNLConnectBySpec, no_hash_exprs)
+{
+  // connect by without prior equal conditions scans the whole right store
+  ObNLConnectBySpec spec(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  fill_spec(spec);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, spec.serialize(buf_, sizeof(buf_), pos));
+  ObNLConnectBySpec decoded(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  const int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, decoded.deserialize(buf_, data_len, pos));
+  check_base(decoded);
+  EXPECT_EQ(0, decoded.hash_key_exprs_.count());
+  EXPECT_EQ(0, decoded.hash_probe_exprs_.count());
+}
+
+TEST_F(TestNLConnectBySpec, compatible)
+{
+  // plan from an old peer, the hash exprs are left empty
+  OldNLConnectBySpec old_spec(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  fill_spec(old_spec);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_spec.serialize(buf_, sizeof(buf_), pos));
+  ObNLConnectBySpec decoded(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, decoded.deserialize(buf_, data_len, pos));
+  EXPECT_EQ(data_len, pos);
+  check_base(decoded);
+  EXPECT_EQ(0, decoded.hash_key_exprs_.count());
+  EXPECT_EQ(0, decoded.hash_probe_exprs_.count());
+
+  // plan to an old peer, the hash exprs are skipped
+  ObNLConnectBySpec spec(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  fill_spec(spec);
+  ASSERT_EQ(OB_SUCCESS, spec.hash_key_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_key_exprs_.push_back(&exprs_.at(1)));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_probe_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, spec.hash_probe_exprs_.push_back(&exprs_.at(2)));
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, spec.serialize(buf_, sizeof(buf_), pos));
+  OldNLConnectBySpec old_decoded(alloc_, PHY_NESTED_LOOP_CONNECT_BY);
+  data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_decoded.deserialize(buf_, data_len, pos));
+  EXPECT_EQ(data_len, pos);
+  check_base(old_decoded);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
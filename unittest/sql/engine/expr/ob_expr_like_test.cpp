@@ -11,8 +11,10 @@
  */
 
 #include <gtest/gtest.h>
+#define private public
 #include "sql/engine/expr/ob_expr_like.h"
-#include "sql/engine/expr/ob_expr_like_context.h"
+#undef private
+#include "lib/allocator/page_arena.h"
 #include "ob_expr_test_utils.h"
 
 using namespace oceanbase::common;
@@ -273,6 +275,127 @@ TEST_F(ObExprLikeTest, is_substr_mode)
 }
 */
 
+// evaluate like the vectorized text path does: build the instr info once, then run
+// memcmp/memmem if the pattern allows it, or wildcmp otherwise
+static void like_bin(ObIAllocator &alloc, const ObString &text, const ObString &pattern,
+                     const ObString &escape, bool &is_instr_mode, int64_t &res)
+{
+  const ObCollationType cs_type = CS_TYPE_BINARY;
+  ObExprLike::ObExprLikeContext like_ctx;
+  like_ctx.instr_info_.set_allocator(alloc);
+  ASSERT_EQ(OB_SUCCESS, ObExprLike::set_instr_info(&alloc, cs_type, pattern, escape,
+                                                   cs_type, like_ctx));
+  ObObj wild_res;
+  ASSERT_EQ(OB_SUCCESS, ObExprLike::calc_with_non_instr_mode(wild_res, cs_type, cs_type,
+                                                             text, pattern, escape));
+  is_instr_mode = like_ctx.is_instr_mode();
+  res = wild_res.get_int();
+  if (is_instr_mode) {
+    const ObExprLike::InstrInfo &info = like_ctx.instr_info_;
+    int64_t instr_res = 0;
+    if (info.empty()) {
+      instr_res = 1;
+    } else if (text.length() < info.instr_total_length_) {
+      instr_res = 0;
+    } else if (START_WITH_PERCENT_SIGN == info.instr_mode_) {
+      instr_res = ObExprLike::match_with_instr_mode<true, false>(text, info);
+    } else if (START_END_WITH_PERCENT_SIGN == info.instr_mode_) {
+      instr_res = ObExprLike::match_with_instr_mode<true, true>(text, info);
+    } else if (END_WITH_PERCENT_SIGN == info.instr_mode_) {
+      instr_res = ObExprLike::match_with_instr_mode<false, true>(text, info);
+    } else {
+      instr_res = ObExprLike::match_with_instr_mode<false, false>(text, info);
+    }
+    // memcmp/memmem must agree with wildcmp
+    EXPECT_EQ(res, instr_res) << std::string(text.ptr(), text.length()) << " like "
+                              << std::string(pattern.ptr(), pattern.length());
+    res = instr_res;
+  }
+}
+
+#define LIKE_BIN(text, pattern, escape, expect_instr, expect_res)                     \
+  do {                                                                                \
+    bool is_instr_mode = false;                                                       \
+    int64_t res = -1;                                                                 \
+    like_bin(alloc, ObString(sizeof(text) - 1, text), ObString(sizeof(pattern) - 1, pattern), \
+             ObString(sizeof(escape) - 1, escape), is_instr_mode, res);               \
+    EXPECT_EQ(expect_instr, is_instr_mode) << text << " like " << pattern;            \
+    EXPECT_EQ(expect_res, res) << text << " like " << pattern;                        \
+  } while (0)
+
+TEST_F(ObExprLikeTest, binary_high_bytes)
+{
+  ObArenaAllocator alloc;
+  // bytes are characters, no multi-byte decoding and no case folding
+  LIKE_BIN("a\xff\xfe" "b", "%\xff\xfe%", "\\", true, 1);
+  LIKE_BIN("a\xff\xfd" "b", "%\xff\xfe%", "\\", true, 0);
+  LIKE_BIN("\xe4\xb8\xad", "\xe4%", "\\", true, 1);
+  LIKE_BIN("\xe4\xb8\xad", "%\xb8\xad", "\\", true, 1);
+  LIKE_BIN("\xe4\xb8\xad", "%\xb8", "\\", true, 0);
+  LIKE_BIN("\x80\x00\x81", "\x80%\x81", "\\", true, 1);
+  LIKE_BIN("\x80\x81", "\x80%\x00%\x81", "\\", true, 0);
+  LIKE_BIN("\x80\x00\x81", "%\x00%", "\\", true, 1);
+  LIKE_BIN("abc", "%B%", "\\", true, 0);
+  LIKE_BIN("\xff\xff", "\xff%\xff\xff", "\\", true, 0);
+  LIKE_BIN("\xff\xff\xff", "\xff%\xff\xff", "\\", true, 1);
+  // no '%', wildcmp does the exact compare
+  LIKE_BIN("\xff\xfe", "\xff\xfe", "\\", false, 1);
+  LIKE_BIN("\xff\xfe", "\xff", "\\", false, 0);
+}
+
+TEST_F(ObExprLikeTest, binary_escape)
+{
+  ObArenaAllocator alloc;
+  // an escape in the pattern leaves instr mode
+  LIKE_BIN("a%bc", "a\\%%", "\\", false, 1);
+  LIKE_BIN("abc", "a\\%%", "\\", false, 0);
+  LIKE_BIN("x_\xff", "%|_\xff", "|", false, 1);
+  LIKE_BIN("xa\xff", "%|_\xff", "|", false, 0);
+  LIKE_BIN("\xff%", "%\xff#%", "#", false, 1);
+  LIKE_BIN("\xff#", "%\xff#%", "#", false, 0);
+  // the escape not used in the pattern keeps instr mode
+  LIKE_BIN("a|b", "%|%", "\\", true, 1);
+  LIKE_BIN("a\\b", "%\\%", "|", true, 1);
+}
+
+TEST_F(ObExprLikeTest, binary_underscore)
+{
+  ObArenaAllocator alloc;
+  // '_' is one byte, so a two byte utf8 character needs two of them
+  LIKE_BIN("abc", "a_c", "\\", false, 1);
+  LIKE_BIN("a\xffz", "a_z", "\\", false, 1);
+  LIKE_BIN("ac", "a_c", "\\", false, 0);
+  LIKE_BIN("a\xc3\xa9z", "a_z", "\\", false, 0);
+  LIKE_BIN("a\xc3\xa9z", "a__z", "\\", false, 1);
+  LIKE_BIN("\xff", "%_", "\\", false, 1);
+  LIKE_BIN("", "%_", "\\", false, 0);
+  LIKE_BIN("\x00\xff", "_%\xff", "\\", false, 1);
+}
+
+TEST_F(ObExprLikeTest, binary_percent_only)
+{
+  ObArenaAllocator alloc;
+  LIKE_BIN("", "%", "\\", true, 1);
+  LIKE_BIN("\xff\x00", "%", "\\", true, 1);
+  LIKE_BIN("\xff\x00", "%%%", "\\", true, 1);
+  LIKE_BIN("", "%%", "\\", true, 1);
+  // a context is rebuilt for every new pattern
+  ObExprLike::ObExprLikeContext like_ctx;
+  like_ctx.instr_info_.set_allocator(alloc);
+  ASSERT_EQ(OB_SUCCESS, ObExprLike::set_instr_info(&alloc, CS_TYPE_BINARY, ObString("%%"),
+                                                   ObString("\\"), CS_TYPE_BINARY, like_ctx));
+  EXPECT_EQ(ALL_PERCENT_SIGN, like_ctx.get_instr_mode());
+  ASSERT_EQ(OB_SUCCESS, ObExprLike::set_instr_info(&alloc, CS_TYPE_BINARY, ObString("%\xff"),
+                                                   ObString("\\"), CS_TYPE_BINARY, like_ctx));
+  EXPECT_EQ(START_WITH_PERCENT_SIGN, like_ctx.get_instr_mode());
+  EXPECT_EQ(1U, like_ctx.instr_info_.instr_cnt_);
+  EXPECT_EQ(1U, like_ctx.instr_info_.instr_total_length_);
+  // collations that are not self-synchronizing stay on wildcmp
+  ASSERT_EQ(OB_SUCCESS, ObExprLike::set_instr_info(&alloc, CS_TYPE_GBK_BIN, ObString("%a%"),
+                                                   ObString("\\"), CS_TYPE_GBK_BIN, like_ctx));
+  EXPECT_FALSE(like_ctx.is_instr_mode());
+}
+
 int main(int argc, char **argv)
 {
   oceanbase::common::ObLogger::get_logger().set_log_level("DEBUG");
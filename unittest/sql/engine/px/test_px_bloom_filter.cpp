@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "lib/hash_func/murmur_hash.h"
+#define private public
+#include "sql/engine/px/ob_px_bloom_filter.h"
+#undef private
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class TestPxBFKeyRange : public ::testing::Test
+{
+public:
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  void check_same(const ObPxBFKeyRange &expect, const ObPxBFKeyRange &range)
+  {
+    EXPECT_EQ(expect.is_valid_, range.is_valid_);
+    EXPECT_EQ(expect.min_, range.min_);
+    EXPECT_EQ(expect.max_, range.max_);
+    ASSERT_EQ(expect.in_count_, range.in_count_);
+    for (int64_t i = 0; i < expect.in_count_; ++i) {
+      EXPECT_EQ(expect.in_list_[i], range.in_list_[i]);
+    }
+  }
+  void round_trip(const ObPxBFKeyRange &range)
+  {
+    char buf[1024];
+    int64_t pos = 0;
+    ASSERT_EQ(OB_SUCCESS, range.serialize(buf, sizeof(buf), pos));
+    EXPECT_EQ(range.get_serialize_size(), pos);
+    ObPxBFKeyRange decoded;
+    const int64_t data_len = pos;
+    pos = 0;
+    ASSERT_EQ(OB_SUCCESS, decoded.deserialize(buf, data_len, pos));
+    EXPECT_EQ(data_len, pos);
+    check_same(range, decoded);
+  }
+};
+
+TEST_F(TestPxBFKeyRange, add_and_might_contain)
+{
+  ObPxBFKeyRange range;
+  // not maintained, every key may match
+  EXPECT_FALSE(range.is_valid());
+  EXPECT_TRUE(range.might_contain(1));
+  range.set_valid();
+  EXPECT_TRUE(range.is_empty());
+  EXPECT_TRUE(range.might_contain(1));
+
+  range.add(10);
+  range.add(-5);
+  range.add(10);
+  EXPECT_FALSE(range.is_empty());
+  EXPECT_EQ(-5, range.min_);
+  EXPECT_EQ(10, range.max_);
+  EXPECT_EQ(2, range.in_count_);
+  EXPECT_TRUE(range.might_contain(10));
+  EXPECT_TRUE(range.might_contain(-5));
+  // inside min/max but not in the in-list
+  EXPECT_FALSE(range.might_contain(0));
+  EXPECT_FALSE(range.might_contain(11));
+  EXPECT_FALSE(range.might_contain(-6));
+
+  // too many distinct keys, only min/max is kept
+  for (int64_t i = 0; i < ObPxBFKeyRange::MAX_IN_LIST_COUNT; ++i) {
+    range.add(i * 100);
+  }
+  EXPECT_EQ(-1, range.in_count_);
+  EXPECT_EQ((ObPxBFKeyRange::MAX_IN_LIST_COUNT - 1) * 100, range.max_);
+  EXPECT_TRUE(range.might_contain(1));
+  EXPECT_FALSE(range.might_contain(-6));
+  range.add(7);
+  EXPECT_EQ(-1, range.in_count_);
+
+  range.reuse();
+  EXPECT_TRUE(range.is_valid());
+  EXPECT_TRUE(range.is_empty());
+  EXPECT_EQ(0, range.in_count_);
+  range.reset();
+  EXPECT_FALSE(range.is_valid());
+}
+
+TEST_F(TestPxBFKeyRange, merge)
+{
+  ObPxBFKeyRange r1;
+  ObPxBFKeyRange r2;
+  r1.set_valid();
+  r2.set_valid();
+  r1.add(1);
+  r1.add(5);
+  r2.add(5);
+  r2.add(9);
+
+  // an invalid range changes nothing, merged into an invalid range it is copied
+  ObPxBFKeyRange invalid;
+  ObPxBFKeyRange target = r1;
+  target.merge(invalid);
+  check_same(r1, target);
+  invalid.merge(r1);
+  check_same(r1, invalid);
+
+  // union of both in-lists, duplicates once
+  target.merge(r2);
+  EXPECT_EQ(1, target.min_);
+  EXPECT_EQ(9, target.max_);
+  EXPECT_EQ(3, target.in_count_);
+  EXPECT_TRUE(target.might_contain(1));
+  EXPECT_TRUE(target.might_contain(5));
+  EXPECT_TRUE(target.might_contain(9));
+  EXPECT_FALSE(target.might_contain(2));
+  // merging the same range again, e.g. a resent piece, is idempotent
+  ObPxBFKeyRange again = target;
+  again.merge(r2);
+  check_same(target, again);
+
+  // an empty range of a worker without rows does not widen min/max
+  ObPxBFKeyRange empty;
+  empty.set_valid();
+  again.merge(empty);
+  check_same(target, again);
+
+  // the union overflows the in-list
+  ObPxBFKeyRange big;
+  big.set_valid();
+  for (int64_t i = 0; i < ObPxBFKeyRange::MAX_IN_LIST_COUNT; ++i) {
+    big.add(100 + i);
+  }
+  EXPECT_EQ(ObPxBFKeyRange::MAX_IN_LIST_COUNT, big.in_count_);
+  ObPxBFKeyRange merged = target;
+  merged.merge(big);
+  EXPECT_EQ(-1, merged.in_count_);
+  EXPECT_EQ(1, merged.min_);
+  EXPECT_EQ(100 + ObPxBFKeyRange::MAX_IN_LIST_COUNT - 1, merged.max_);
+  EXPECT_TRUE(merged.might_contain(50));
+
+  // an overflowed side drops the in-list of the other side
+  ObPxBFKeyRange overflowed = target;
+  overflowed.merge(merged);
+  EXPECT_EQ(-1, overflowed.in_count_);
+  merged = target;
+  merged.merge(overflowed);
+  EXPECT_EQ(-1, merged.in_count_);
+}
+
+TEST_F(TestPxBFKeyRange, serialize)
+{
+  ObPxBFKeyRange range;
+  round_trip(range);
+  range.set_valid();
+  round_trip(range);
+  range.add(-3);
+  range.add(INT64_MAX);
+  range.add(42);
+  round_trip(range);
+  for (int64_t i = 0; i < ObPxBFKeyRange::MAX_IN_LIST_COUNT; ++i) {
+    range.add(i);
+  }
+  EXPECT_EQ(-1, range.in_count_);
+  round_trip(range);
+
+  // a corrupted in-list count is rejected
+  ObPxBFKeyRange bad;
+  bad.set_valid();
+  bad.add(1);
+  bad.in_count_ = ObPxBFKeyRange::MAX_IN_LIST_COUNT + 1;
+  char buf[1024];
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, bad.serialize(buf, sizeof(buf), pos));
+  ObPxBFKeyRange decoded;
+  const int64_t data_len = pos;
+  pos = 0;
+  EXPECT_EQ(OB_ERR_UNEXPECTED, decoded.deserialize(buf, data_len, pos));
+}
+
+TEST_F(TestPxBFKeyRange, bloom_filter_pieces)
+{
+  ObArenaAllocator allocator;
+  ObPxBloomFilter build;
+  ASSERT_EQ(OB_SUCCESS, build.init(10000, allocator));
+  build.key_range_.set_valid();
+  for (int64_t i = 0; i < 10; ++i) {
+    ASSERT_EQ(OB_SUCCESS, build.put(murmurhash(&i, sizeof(i), 0)));
+    build.key_range_.add(i * 3);
+  }
+  ASSERT_LT(1, build.bits_array_length_);
+
+  // send the bits in two pieces like the px bloom filter channels do, each carries the key range
+  const int64_t mid = build.bits_array_length_ / 2;
+  const int64_t pieces[][2] = {{0, mid - 1}, {mid, build.bits_array_length_ - 1}};
+  ObPxBloomFilter probe;
+  ASSERT_EQ(OB_SUCCESS, probe.init(10000, allocator));
+  for (int64_t i = 0; i < 2; ++i) {
+    build.set_begin_idx(pieces[i][0]);
+    build.set_end_idx(pieces[i][1]);
+    const int64_t buf_len = build.get_serialize_size();
+    char *buf = static_cast<char *>(allocator.alloc(buf_len));
+    ASSERT_TRUE(NULL != buf);
+    int64_t pos = 0;
+    ASSERT_EQ(OB_SUCCESS, build.serialize(buf, buf_len, pos));
+    ASSERT_EQ(buf_len, pos);
+    ObPxBloomFilter piece;
+    pos = 0;
+    ASSERT_EQ(OB_SUCCESS, piece.deserialize(buf, buf_len, pos));
+    check_same(build.key_range_, piece.get_key_range());
+    ASSERT_EQ(OB_SUCCESS, probe.merge_filter(&piece));
+  }
+  for (int64_t i = 0; i < build.bits_array_length_; ++i) {
+    EXPECT_EQ(build.bits_array_[i], probe.bits_array_[i]);
+  }
+  check_same(build.key_range_, probe.get_key_range());
+  for (int64_t i = 0; i < 10; ++i) {
+    bool is_match = false;
+    ASSERT_EQ(OB_SUCCESS, probe.might_contain(murmurhash(&i, sizeof(i), 0), is_match));
+    EXPECT_TRUE(is_match);
+    EXPECT_TRUE(probe.get_key_range().might_contain(i * 3));
+  }
+  EXPECT_FALSE(probe.get_key_range().might_contain(1));
+  EXPECT_FALSE(probe.get_key_range().might_contain(30));
+
+  // a second build worker widens the key range
+  ObPxBFKeyRange other;
+  other.set_valid();
+  other.add(1000);
+  probe.merge_key_range(other);
+  EXPECT_EQ(0, probe.get_key_range().min_);
+  EXPECT_EQ(1000, probe.get_key_range().max_);
+  EXPECT_TRUE(probe.get_key_range().might_contain(1000));
+  EXPECT_FALSE(probe.get_key_range().might_contain(999));
+
+  // reset for rescan forgets the keys
+  probe.reset_filter();
+  EXPECT_TRUE(probe.get_key_range().is_empty());
+  EXPECT_TRUE(probe.get_key_range().might_contain(999));
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -19,6 +19,16 @@ namespace oceanbase
 {
 namespace sql
 {
+// ObTableRowCount as serialized before the estimated row count was added
+struct OldTableRowCount
+{
+  int64_t op_id_;
+  int64_t row_count_;
+  OB_UNIS_VERSION(1);
+};
+
+OB_SERIALIZE_MEMBER(OldTableRowCount, op_id_, row_count_);
+
 class TestPhysicalPlan : public ::testing::Test
 {
 public:
@@ -42,6 +52,80 @@ TEST_F(TestPhysicalPlan,  test_get_view_table)
   }
   EXPECT_EQ(VIEW_COUNT, plan.get_dependency_table_size());
 }
+
+TEST_F(TestPhysicalPlan, test_card_deviated)
+{
+  ObPhysicalPlan plan;
+  const int64_t threshold = ObPhysicalPlan::CARD_FEEDBACK_THRESHOLD;
+  // more than threshold times in either direction
+  EXPECT_FALSE(plan.is_card_deviated(1000, 1000 * threshold));
+  EXPECT_TRUE(plan.is_card_deviated(1000, 1000 * (threshold + 1)));
+  EXPECT_FALSE(plan.is_card_deviated(1000 * threshold, 1000));
+  EXPECT_TRUE(plan.is_card_deviated(1000 * (threshold + 1), 1000));
+  // zero rows are counted as one
+  EXPECT_TRUE(plan.is_card_deviated(0, 1000));
+  EXPECT_TRUE(plan.is_card_deviated(1000, 0));
+  // small tables are never deviated
+  const int64_t floor = ObPhysicalPlan::EXPIRED_PLAN_TABLE_ROW_THRESHOLD;
+  EXPECT_FALSE(plan.is_card_deviated(0, floor));
+  EXPECT_FALSE(plan.is_card_deviated(floor, 1));
+  EXPECT_TRUE(plan.is_card_deviated(0, floor + 1));
+  EXPECT_TRUE(plan.is_card_deviated(floor + 1, 0));
+}
+
+TEST_F(TestPhysicalPlan, test_card_misestimated)
+{
+  ObPhysicalPlan plan;
+  const int64_t threshold = ObPhysicalPlan::CARD_FEEDBACK_THRESHOLD;
+  const int64_t est = 1000;
+  // first execution matched the estimate, current one is far from it
+  EXPECT_TRUE(plan.check_if_card_misestimated(est, ObTableRowCount(1, est * (threshold + 1), est)));
+  EXPECT_TRUE(plan.check_if_card_misestimated(est / 2, ObTableRowCount(1, 0, est)));
+  EXPECT_FALSE(plan.check_if_card_misestimated(est, ObTableRowCount(1, est * threshold, est)));
+  EXPECT_FALSE(plan.check_if_card_misestimated(est, ObTableRowCount(1, est, est)));
+  // estimate was already off on the first execution, replanning would not help
+  EXPECT_FALSE(plan.check_if_card_misestimated(est * (threshold + 1),
+                                               ObTableRowCount(1, est * 100, est)));
+  EXPECT_FALSE(plan.check_if_card_misestimated(0, ObTableRowCount(1, est * 100, est)));
+  // estimate unknown: old peers, multi-partition scans, or no first execution stat
+  EXPECT_FALSE(plan.check_if_card_misestimated(est, ObTableRowCount(1, est * 100)));
+  EXPECT_FALSE(plan.check_if_card_misestimated(est, ObTableRowCount(1, est * 100, -1)));
+  EXPECT_FALSE(plan.check_if_card_misestimated(-1, ObTableRowCount(1, est * 100, est)));
+  // below EXPIRED_PLAN_TABLE_ROW_THRESHOLD rows nothing is expired
+  const int64_t floor = ObPhysicalPlan::EXPIRED_PLAN_TABLE_ROW_THRESHOLD;
+  EXPECT_FALSE(plan.check_if_card_misestimated(1, ObTableRowCount(1, floor, 1)));
+  EXPECT_TRUE(plan.check_if_card_misestimated(1, ObTableRowCount(1, floor + 1, 1)));
+}
+
+TEST_F(TestPhysicalPlan, test_table_row_count_compat)
+{
+  ObTableRowCount row_count(3, 500, 20);
+  char buf[128];
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, row_count.serialize(buf, sizeof(buf), pos));
+  ObTableRowCount decoded;
+  int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, decoded.deserialize(buf, data_len, pos));
+  EXPECT_EQ(3, decoded.op_id_);
+  EXPECT_EQ(500, decoded.row_count_);
+  EXPECT_EQ(20, decoded.est_row_count_);
+
+  // an old peer sends op_id_ and row_count_ only, the estimate stays unknown
+  OldTableRowCount old_row_count;
+  old_row_count.op_id_ = 3;
+  old_row_count.row_count_ = 500;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_row_count.serialize(buf, sizeof(buf), pos));
+  ObTableRowCount old_decoded;
+  data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_decoded.deserialize(buf, data_len, pos));
+  EXPECT_EQ(data_len, pos);
+  EXPECT_EQ(3, old_decoded.op_id_);
+  EXPECT_EQ(500, old_decoded.row_count_);
+  EXPECT_EQ(-1, old_decoded.est_row_count_);
+}
 } //namespace sql
 } //namespace oceanbase
 
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include "lib/alloc/ob_malloc_allocator.h"
+#include "share/datum/ob_datum_funcs.h"
+#define private public
+#include "sql/engine/window_function/ob_window_function_op.h"
+#undef private
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+class TestEnv : public ::testing::Environment
+{
+public:
+  virtual void SetUp() override
+  {
+    lib::ObMallocAllocator *malloc_allocator = lib::ObMallocAllocator::get_instance();
+    ASSERT_EQ(OB_SUCCESS, malloc_allocator->create_tenant_ctx_allocator(
+        OB_SYS_TENANT_ID, common::ObCtxIds::WORK_AREA));
+    int s = (int)time(NULL);
+    LOG_INFO("initial setup random seed", K(s));
+    srandom(s);
+  }
+  virtual void TearDown() override {}
+};
+
+typedef ObWindowFunctionOp::ExtremumDeque ExtremumDeque;
+
+class TestExtremumDeque : public ::testing::Test
+{
+public:
+  static const int64_t NULL_VAL = INT64_MIN;
+  void SetUp() override
+  {
+    int_cmp_ = ObDatumFuncs::get_nullsafe_cmp_func(ObIntType, ObIntType, NULL_FIRST,
+                                                   CS_TYPE_BINARY, false);
+    str_cmp_ = ObDatumFuncs::get_nullsafe_cmp_func(ObVarcharType, ObVarcharType, NULL_FIRST,
+                                                   CS_TYPE_UTF8MB4_BIN, false);
+    ASSERT_TRUE(NULL != int_cmp_);
+    ASSERT_TRUE(NULL != str_cmp_);
+  }
+
+  // Slide frame [i - preceding, i + following] over vals and check the deque front
+  // against the brute force MIN/MAX of the frame, NULL_VAL stands for null.
+  void check_sliding(const bool is_max, const ObIArray<int64_t> &vals,
+                     const int64_t preceding, const int64_t following)
+  {
+    ExtremumDeque deque;
+    deque.init(is_max, int_cmp_, OB_SYS_TENANT_ID);
+    const int64_t cnt = vals.count();
+    int64_t pushed = 0;
+    for (int64_t i = 0; i < cnt; i++) {
+      const int64_t head = std::max(0L, i - preceding);
+      const int64_t tail = std::min(cnt - 1, i + following);
+      for (; pushed <= tail; pushed++) {
+        ObDatum d;
+        if (NULL_VAL == vals.at(pushed)) {
+          d.set_null();
+        } else {
+          d.set_string(reinterpret_cast<const char *>(&vals.at(pushed)), sizeof(int64_t));
+        }
+        ASSERT_EQ(OB_SUCCESS, deque.push(pushed, d));
+      }
+      deque.pop_before(head);
+      bool all_null = true;
+      int64_t expect = 0;
+      for (int64_t j = head; j <= tail; j++) {
+        const int64_t v = vals.at(j);
+        if (NULL_VAL != v) {
+          if (all_null || (is_max ? v > expect : v < expect)) {
+            expect = v;
+          }
+          all_null = false;
+        }
+      }
+      ASSERT_EQ(all_null, deque.empty()) << "row " << i;
+      if (!all_null) {
+        ASSERT_EQ(expect, deque.front().get_int()) << "row " << i;
+      }
+      // the deque keeps at most one item per row of the frame
+      ASSERT_GE(tail - head + 1, deque.items_.count() - deque.head_);
+    }
+  }
+protected:
+  ObDatumCmpFuncType int_cmp_;
+  ObDatumCmpFuncType str_cmp_;
+};
+
+TEST_F(TestExtremumDeque, monotonic)
+{
+  ObArray<int64_t> asc;
+  ObArray<int64_t> desc;
+  for (int64_t i = 0; i < 3000; i++) {
+    ASSERT_EQ(OB_SUCCESS, asc.push_back(i));
+    ASSERT_EQ(OB_SUCCESS, desc.push_back(3000 - i));
+  }
+  // the extremum slides out of the frame on every row, the worst case of restarting
+  check_sliding(false, asc, 5, 0);
+  check_sliding(true, desc, 5, 0);
+  check_sliding(true, asc, 5, 3);
+  check_sliding(false, desc, 0, 7);
+}
+
+TEST_F(TestExtremumDeque, random_with_dup_and_null)
+{
+  ObArray<int64_t> vals;
+  for (int64_t i = 0; i < 5000; i++) {
+    const int64_t r = random() % 20;
+    ASSERT_EQ(OB_SUCCESS, vals.push_back(0 == r ? NULL_VAL : r % 7));
+  }
+  // a run of nulls makes the frame empty
+  for (int64_t i = 100; i < 120; i++) {
+    vals.at(i) = NULL_VAL;
+  }
+  const int64_t frames[][2] = {{0, 0}, {1, 1}, {3, 0}, {0, 3}, {10, 10}, {100, 2}};
+  for (int64_t i = 0; i < ARRAYSIZEOF(frames); i++) {
+    check_sliding(true, vals, frames[i][0], frames[i][1]);
+    check_sliding(false, vals, frames[i][0], frames[i][1]);
+  }
+}
+
+TEST_F(TestExtremumDeque, compact)
+{
+  // long strings, popped values soon hold most of the arena and it is compacted
+  ExtremumDeque deque;
+  deque.init(false, str_cmp_, OB_SYS_TENANT_ID);
+  const int64_t cnt = 4000;
+  const int64_t frame = 4;
+  char buf[1024];
+  int64_t compacted = 0;
+  int64_t last_alloc = deque.cur_alloc_;
+  for (int64_t i = 0; i < cnt; i++) {
+    // ascending values, only the front leaves, every row stays in the deque until then
+    MEMSET(buf, 'a', sizeof(buf));
+    snprintf(buf, 16, "%010ld", i);
+    buf[10] = 'a';
+    ObDatum d;
+    d.set_string(buf, sizeof(buf));
+    ASSERT_EQ(OB_SUCCESS, deque.push(i, d));
+    deque.pop_before(i - frame + 1);
+    char expect[16];
+    snprintf(expect, sizeof(expect), "%010ld", std::max(0L, i - frame + 1));
+    ASSERT_FALSE(deque.empty());
+    ASSERT_EQ(0, MEMCMP(expect, deque.front().ptr_, 10)) << "row " << i;
+    ASSERT_EQ(static_cast<int64_t>(sizeof(buf)), deque.front().len_);
+    if (deque.cur_alloc_ != last_alloc) {
+      compacted++;
+      last_alloc = deque.cur_alloc_;
+    }
+    ASSERT_LE(deque.items_.count() - deque.head_, frame);
+  }
+  EXPECT_LT(0, compacted);
+  // memory is bounded by the live values instead of all pushed ones
+  EXPECT_GT(cnt * static_cast<int64_t>(sizeof(buf)) / 4, deque.allocs_[deque.cur_alloc_].used());
+
+  deque.reuse();
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(0, deque.live_size_);
+}
+
+TEST_F(TestExtremumDeque, equal_values)
+{
+  // equal values are all kept, the earliest is popped first
+  ExtremumDeque deque;
+  deque.init(true, int_cmp_, OB_SYS_TENANT_ID);
+  int64_t vals[] = {5, 5, 5, 3};
+  for (int64_t i = 0; i < ARRAYSIZEOF(vals); i++) {
+    ObDatum d;
+    d.set_string(reinterpret_cast<const char *>(&vals[i]), sizeof(int64_t));
+    ASSERT_EQ(OB_SUCCESS, deque.push(i, d));
+  }
+  EXPECT_EQ(4, deque.items_.count() - deque.head_);
+  deque.pop_before(2);
+  ASSERT_FALSE(deque.empty());
+  EXPECT_EQ(5, deque.front().get_int());
+  EXPECT_EQ(2, deque.items_.at(deque.head_).idx_);
+  deque.pop_before(3);
+  EXPECT_EQ(3, deque.front().get_int());
+  deque.pop_before(4);
+  EXPECT_TRUE(deque.empty());
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new oceanbase::sql::TestEnv());
+  return RUN_ALL_TESTS();
+}
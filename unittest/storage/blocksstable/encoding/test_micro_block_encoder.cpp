@@ -221,6 +221,136 @@ TEST_F(TestDictLargeVarchar, test_dict_large_varchar)
   ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[3], read_row.storage_datums_[3]));
 }
 
+TEST(TestPreviousEncodingArray, stable_count)
+{
+  ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> pe_array;
+  const ObPreviousEncoding dict(ObColumnHeader::DICT, 0);
+  const ObPreviousEncoding raw(ObColumnHeader::RAW, 0);
+  ASSERT_EQ(0, pe_array.stable_cnt_);
+  for (int64_t i = 1; i <= 3; ++i) {
+    ASSERT_EQ(OB_SUCCESS, pe_array.put(dict));
+    ASSERT_EQ(i, pe_array.stable_cnt_);
+  }
+  ASSERT_EQ(OB_SUCCESS, pe_array.put(raw));
+  ASSERT_EQ(1, pe_array.stable_cnt_);
+  // switch back to an encoding still kept in the array restarts counting
+  ASSERT_EQ(OB_SUCCESS, pe_array.put(dict));
+  ASSERT_EQ(1, pe_array.stable_cnt_);
+  ASSERT_EQ(2, pe_array.size_);
+  pe_array.record_size(100, 10);
+  ASSERT_EQ(100, pe_array.last_size_);
+  ASSERT_EQ(10, pe_array.last_row_cnt_);
+  pe_array.reuse();
+  ASSERT_EQ(0, pe_array.size_);
+  ASSERT_EQ(0, pe_array.stable_cnt_);
+  ASSERT_EQ(0, pe_array.last_size_);
+  ASSERT_EQ(0, pe_array.last_row_cnt_);
+}
+
+static ObObjType test_stable_encoding_col_types[2] = {ObIntType, ObVarcharType};
+class TestStableEncoding : public TestIColumnEncoder
+{
+public:
+  static const int64_t ROW_CNT = 100;
+  TestStableEncoding()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = 2;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = test_stable_encoding_col_types[i];
+    }
+  }
+  virtual ~TestStableEncoding()
+  {
+    allocator_.free(col_types_);
+  }
+
+  // build one micro block, check it decodes and return the encoding of the int column
+  void build_and_check(ObMicroBlockEncoder &encoder, ObColumnHeader::Type &type)
+  {
+    const char *strs[] = {"stable", "encoding", "reuse", "test"};
+    ObDatumRow row;
+    ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+    encoder.reuse();
+    for (int64_t i = 0; i < ROW_CNT; ++i) {
+      row.storage_datums_[0].set_int(i);
+      row.storage_datums_[1].set_string(strs[i % 4], static_cast<int32_t>(strlen(strs[i % 4])));
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row)) << "i: " << i;
+    }
+    char *buf = NULL;
+    int64_t size = 0;
+    ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+    type = static_cast<ObColumnHeader::Type>(encoder.encoders_.at(0)->get_column_header().type_);
+
+    ObMicroBlockDecoder decoder;
+    ObMicroBlockData data(buf, size);
+    ObDatumRow read_row;
+    ASSERT_EQ(OB_SUCCESS, read_row.init(allocator_, column_cnt_));
+    ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+    for (int64_t i = 0; i < ROW_CNT; ++i) {
+      ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+      ASSERT_EQ(i, read_row.storage_datums_[0].get_int());
+      ASSERT_EQ(0, MEMCMP(strs[i % 4], read_row.storage_datums_[1].ptr_, read_row.storage_datums_[1].len_));
+    }
+  }
+
+  // pretend DICT has been chosen by the former micro blocks of the int column
+  void fake_history(ObMicroBlockEncoder &encoder, const int64_t stable_cnt,
+      const int64_t last_size, const int64_t micro_block_cnt)
+  {
+    ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> &pe_array =
+        encoder.ctx_.previous_encodings_.at(0);
+    pe_array.prev_encodings_[pe_array.last_pos_] = ObPreviousEncoding(ObColumnHeader::DICT, 0);
+    pe_array.stable_cnt_ = stable_cnt;
+    pe_array.last_size_ = last_size;
+    pe_array.last_row_cnt_ = ROW_CNT;
+    encoder.ctx_.micro_block_cnt_ = micro_block_cnt;
+  }
+};
+
+TEST_F(TestStableEncoding, reuse_stable_encoding)
+{
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObColumnHeader::Type full_type = ObColumnHeader::MAX_TYPE;
+  ObColumnHeader::Type type = ObColumnHeader::MAX_TYPE;
+
+  // same data chooses the same encoding and becomes stable
+  build_and_check(encoder, full_type);
+  for (int64_t i = 1; i < ObMicroBlockEncoder::STABLE_ENCODING_THRESHOLD; ++i) {
+    build_and_check(encoder, type);
+    ASSERT_EQ(full_type, type);
+  }
+  ASSERT_EQ(ObMicroBlockEncoder::STABLE_ENCODING_THRESHOLD, encoder.ctx_.previous_encodings_.at(0).stable_cnt_);
+  // dictionary of distinct integers never wins by full evaluation
+  ASSERT_NE(ObColumnHeader::DICT, full_type);
+
+  const int64_t no_drift_size = 1L << 30;
+  const int64_t non_sampling_cnt = 5;
+  ASSERT_FALSE(0 == non_sampling_cnt % 4);
+
+  // stable encoding is reused without full evaluation
+  fake_history(encoder, ObMicroBlockEncoder::STABLE_ENCODING_THRESHOLD, no_drift_size, non_sampling_cnt);
+  build_and_check(encoder, type);
+  ASSERT_EQ(ObColumnHeader::DICT, type);
+
+  // size per row grows too much, evaluate all encodings
+  fake_history(encoder, ObMicroBlockEncoder::STABLE_ENCODING_THRESHOLD, 1, non_sampling_cnt);
+  build_and_check(encoder, type);
+  ASSERT_EQ(full_type, type);
+
+  // not stable yet
+  fake_history(encoder, ObMicroBlockEncoder::STABLE_ENCODING_THRESHOLD - 1, no_drift_size, non_sampling_cnt);
+  build_and_check(encoder, type);
+  ASSERT_EQ(full_type, type);
+
+  // sampling round always evaluates all encodings
+  fake_history(encoder, ObMicroBlockEncoder::STABLE_ENCODING_THRESHOLD, no_drift_size, 8);
+  build_and_check(encoder, type);
+  ASSERT_EQ(full_type, type);
+}
+
 class TestEncodingRowBufHolder : public ::testing::Test
 {
 public:
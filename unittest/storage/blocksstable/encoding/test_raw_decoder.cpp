@@ -21,6 +21,8 @@
 #include "storage/blocksstable/encoding/ob_raw_encoder.h"
 #include "storage/blocksstable/ob_row_writer.h"
 #include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_block_batched_row_store.h"
+#include "storage/access/ob_table_access_context.h"
 #include "storage/ob_i_store.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/basic/ob_pushdown_filter.h"
@@ -852,6 +854,186 @@ TEST_F(TestRawDecoder, opt_batch_decode_to_datum)
   }
 }
 
+class TestBatchedRowStore : public ObBlockBatchedRowStore
+{
+public:
+  TestBatchedRowStore(const int64_t batch_size, sql::ObEvalCtx &eval_ctx, ObTableAccessContext &context)
+    : ObBlockBatchedRowStore(batch_size, eval_ctx, context) {}
+  virtual ~TestBatchedRowStore() {}
+  virtual int fill_row(blocksstable::ObDatumRow &out_row) override
+  { UNUSED(out_row); return OB_SUCCESS; }
+  virtual int fill_rows(const int64_t group_idx, blocksstable::ObIMicroBlockReader *reader,
+                        int64_t &begin_index, const int64_t end_index,
+                        const common::ObBitmap *bitmap = nullptr) override
+  { UNUSEDx(group_idx, reader, begin_index, end_index, bitmap); return OB_SUCCESS; }
+};
+
+// filter columns of an AND child are decoded only for the rows surviving the former siblings
+TEST_F(TestRawDecoder, copy_selected_filter_rows)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  ObTableAccessContext access_ctx;
+  TestBatchedRowStore store(ROW_CNT, eval_ctx, access_ctx);
+  store.is_inited_ = true;
+  store.row_capacity_ = ROW_CNT;
+  store.row_ids_ = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * ROW_CNT));
+  store.cell_data_ptrs_ = static_cast<const char **>(allocator_.alloc(sizeof(char *) * ROW_CNT));
+  ASSERT_TRUE(nullptr != store.row_ids_ && nullptr != store.cell_data_ptrs_);
+
+  // the first rowkey column
+  const int32_t col_offset = 0;
+  ObSEArray<int32_t, 1> cols;
+  ObSEArray<const share::schema::ObColumnParam *, 1> col_params;
+  ObSEArray<ObDatum *, 1> datums;
+  ObDatum col_datums[ROW_CNT];
+  ObDatum expect_datums[ROW_CNT];
+  char *datum_buf = static_cast<char *>(allocator_.alloc(128 * ROW_CNT * 2));
+  ASSERT_TRUE(nullptr != datum_buf);
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    col_datums[i].ptr_ = datum_buf + i * 128;
+    expect_datums[i].ptr_ = datum_buf + (ROW_CNT + i) * 128;
+  }
+  ASSERT_EQ(OB_SUCCESS, cols.push_back(col_offset));
+  ASSERT_EQ(OB_SUCCESS, col_params.push_back(nullptr));
+  ASSERT_EQ(OB_SUCCESS, datums.push_back(col_datums));
+
+  // decode every row as expected result
+  int64_t all_row_ids[ROW_CNT];
+  const char *cell_datas[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    all_row_ids[i] = i;
+  }
+  ObSEArray<ObDatum *, 1> expect_col;
+  ASSERT_EQ(OB_SUCCESS, expect_col.push_back(expect_datums));
+  ASSERT_EQ(OB_SUCCESS, decoder.get_rows(cols, col_params, all_row_ids, cell_datas, ROW_CNT, expect_col));
+
+  // rows 1, 4, 7 ... and the last row survived the former siblings
+  ObBitmap selected(allocator_);
+  ASSERT_EQ(OB_SUCCESS, selected.init(ROW_CNT));
+  int64_t expect_row_ids[ROW_CNT];
+  int64_t expect_cnt = 0;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    if (1 == i % 3 || ROW_CNT - 1 == i) {
+      ASSERT_EQ(OB_SUCCESS, selected.set(i));
+      expect_row_ids[expect_cnt++] = i;
+    }
+  }
+
+  int64_t begin = 0;
+  int64_t row_count = 0;
+  ASSERT_EQ(OB_SUCCESS, store.copy_filter_rows(&decoder, begin, ROW_CNT, selected, cols,
+                                               col_params, datums, row_count));
+  ASSERT_EQ(expect_cnt, row_count);
+  ASSERT_EQ(ROW_CNT, begin);
+  for (int64_t i = 0; i < row_count; ++i) {
+    ASSERT_EQ(expect_row_ids[i], store.row_ids_[i]);
+    ASSERT_TRUE(ObDatum::binary_equal(expect_datums[expect_row_ids[i]], col_datums[i])) << "i: " << i;
+  }
+
+  // a sub range of the micro block
+  begin = 10;
+  ASSERT_EQ(OB_SUCCESS, store.copy_filter_rows(&decoder, begin, 20, selected, cols,
+                                               col_params, datums, row_count));
+  ASSERT_EQ(3, row_count);
+  ASSERT_EQ(10, store.row_ids_[0]);
+  ASSERT_EQ(13, store.row_ids_[1]);
+  ASSERT_EQ(16, store.row_ids_[2]);
+  for (int64_t i = 0; i < row_count; ++i) {
+    ASSERT_TRUE(ObDatum::binary_equal(expect_datums[store.row_ids_[i]], col_datums[i]));
+  }
+
+  // nothing survived, no row is decoded
+  selected.reuse(false);
+  begin = 0;
+  ASSERT_EQ(OB_SUCCESS, store.copy_filter_rows(&decoder, begin, ROW_CNT, selected, cols,
+                                               col_params, datums, row_count));
+  ASSERT_EQ(0, row_count);
+  store.row_ids_ = nullptr;
+  store.cell_data_ptrs_ = nullptr;
+}
+
+template <typename T>
+static bool fast_filter_ref_cmp(const T left, const T right, const int32_t op_type)
+{
+  bool res = false;
+  switch (op_type) {
+    case sql::WHITE_OP_EQ: res = left == right; break;
+    case sql::WHITE_OP_LE: res = left <= right; break;
+    case sql::WHITE_OP_LT: res = left < right; break;
+    case sql::WHITE_OP_GE: res = left >= right; break;
+    case sql::WHITE_OP_GT: res = left > right; break;
+    case sql::WHITE_OP_NE: res = left != right; break;
+    default: break;
+  }
+  return res;
+}
+
+template <typename T>
+static void check_fast_filter_func(const int64_t is_signed, const int64_t row_cnt, const int64_t seed)
+{
+  const int64_t len = sizeof(T);
+  T values[row_cnt];
+  srand(static_cast<unsigned int>(seed));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    // small value domain so that eq/ne and the boundaries are all hit
+    values[i] = static_cast<T>(rand() % 17 - (is_signed ? 8 : 0));
+  }
+  values[0] = std::numeric_limits<T>::max();
+  values[row_cnt - 1] = std::numeric_limits<T>::min();
+  const T params[] = {0, 3, static_cast<T>(-1), std::numeric_limits<T>::max(),
+                      std::numeric_limits<T>::min()};
+  const int64_t size = sql::ObBitVector::memory_size(row_cnt);
+  char buf[size];
+  sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+  for (int64_t p = 0; p < sizeof(params) / sizeof(T); ++p) {
+    uint64_t node_value = 0;
+    MEMCPY(&node_value, &params[p], len);
+    for (int32_t op_type = sql::WHITE_OP_EQ; op_type <= sql::WHITE_OP_NE; ++op_type) {
+      bit_vec->reset(row_cnt);
+      raw_fix_fast_filter_funcs[is_signed][get_value_len_tag_map()[len]][op_type](
+          row_cnt, reinterpret_cast<const unsigned char *>(values), node_value, *bit_vec);
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        ASSERT_EQ(fast_filter_ref_cmp<T>(values[i], params[p], op_type), bit_vec->at(i))
+            << "len: " << len << " signed: " << is_signed << " op: " << op_type
+            << " row: " << i << " param idx: " << p;
+      }
+    }
+  }
+}
+
+// the (possibly SIMD) fast filter kernels must give the same result as a scalar compare,
+// row counts are chosen to run both the vectorized body and the tail loop.
+TEST(TestRawFixFastFilter, compare_with_scalar)
+{
+  ASSERT_TRUE(raw_fix_fast_filter_funcs_inited);
+  const int64_t row_cnts[] = {1, 7, 8, 9, 64, 1023};
+  for (int64_t i = 0; i < sizeof(row_cnts) / sizeof(int64_t); ++i) {
+    const int64_t row_cnt = row_cnts[i];
+    check_fast_filter_func<uint8_t>(0, row_cnt, i);
+    check_fast_filter_func<int8_t>(1, row_cnt, i);
+    check_fast_filter_func<uint16_t>(0, row_cnt, i);
+    check_fast_filter_func<int16_t>(1, row_cnt, i);
+    check_fast_filter_func<uint32_t>(0, row_cnt, i);
+    check_fast_filter_func<int32_t>(1, row_cnt, i);
+    check_fast_filter_func<uint64_t>(0, row_cnt, i);
+    check_fast_filter_func<int64_t>(1, row_cnt, i);
+  }
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
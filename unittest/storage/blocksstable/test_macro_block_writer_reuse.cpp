@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "ob_multi_version_sstable_test.h"
+#include "storage/blocksstable/ob_index_block_macro_iterator.h"
+#include "storage/compaction/ob_index_block_micro_iterator.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace compaction;
+using namespace storage;
+
+namespace unittest
+{
+
+class TestMacroBlockWriterReuse : public ObMultiVersionSSTableTest
+{
+public:
+  TestMacroBlockWriterReuse() : ObMultiVersionSSTableTest("test_macro_block_writer_reuse", MAJOR_MERGE) {}
+  virtual ~TestMacroBlockWriterReuse() {}
+
+  void gen_micro_data(const int64_t start_key, const int64_t row_cnt, std::string &micro_data);
+  void append_rows(const char *micro_data);
+  void scan_keys(ObSSTable &sstable, ObIArray<int64_t> &keys);
+
+  static const int64_t SNAPSHOT_VERSION = 10;
+  static const int64_t SCHEMA_ROWKEY_CNT = 1;
+  // rows of ~200 bytes, so that LARGE_ROW_CNT rows take more than half of a micro block
+  static const int64_t VALUE_LENGTH = 160;
+  static const int64_t LARGE_ROW_CNT = 8;
+  static const int64_t SMALL_ROW_CNT = 2;
+};
+
+void TestMacroBlockWriterReuse::gen_micro_data(
+    const int64_t start_key,
+    const int64_t row_cnt,
+    std::string &micro_data)
+{
+  const std::string value(VALUE_LENGTH, 'v');
+  char row[512];
+  micro_data = "bigint   bigint   bigint   var   flag    multi_version_row_flag\n";
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    snprintf(row, sizeof(row), "%ld   -%ld   0   %s   EXIST   CLF\n",
+             start_key + i, SNAPSHOT_VERSION, value.c_str());
+    micro_data.append(row);
+  }
+}
+
+void TestMacroBlockWriterReuse::append_rows(const char *micro_data)
+{
+  ObMockIterator iter;
+  OK(iter.from(micro_data));
+  append_micro_block(iter);
+}
+
+void TestMacroBlockWriterReuse::scan_keys(ObSSTable &sstable, ObIArray<int64_t> &keys)
+{
+  ObDatumRange range;
+  range.set_whole_range();
+  ObQueryFlag query_flag;
+  ObStoreCtx store_ctx;
+  ObVersionRange trans_version_range;
+  trans_version_range.base_version_ = 0;
+  trans_version_range.multi_version_start_ = 0;
+  trans_version_range.snapshot_version_ = SNAPSHOT_VERSION;
+  iter_param_.reset();
+  iter_param_.table_id_ = table_id_;
+  iter_param_.tablet_id_ = tablet_id_;
+  iter_param_.read_info_ = &full_read_info_;
+  iter_param_.full_read_info_ = &full_read_info_;
+  context_.reset();
+  OK(context_.init(query_flag, store_ctx, allocator_, allocator_, trans_version_range));
+
+  ObStoreRowIterator *row_iter = nullptr;
+  const ObDatumRow *row = nullptr;
+  OK(sstable.scan(iter_param_, context_, range, row_iter));
+  ASSERT_NE(nullptr, row_iter);
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(row_iter->get_next_row(row))) {
+    ASSERT_NE(nullptr, row);
+    OK(keys.push_back(row->storage_datums_[0].get_int()));
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+  row_iter->~ObStoreRowIterator();
+}
+
+// A few rows of a rewritten micro block are pending when a large unchanged
+// micro block arrives and both do not fit in one micro block: the pending rows
+// are flushed as a small micro block and the incoming one is reused as is.
+TEST_F(TestMacroBlockWriterReuse, flush_pending_and_reuse_large_micro_block)
+{
+  std::string large_data;
+  std::string small_data;
+  gen_micro_data(10, LARGE_ROW_CNT, large_data);
+  gen_micro_data(1, SMALL_ROW_CNT, small_data);
+  const char *micro_data[1] = { large_data.c_str() };
+  ObLogTsRange log_ts_range;
+  log_ts_range.start_log_ts_ = 0;
+  log_ts_range.end_log_ts_ = SNAPSHOT_VERSION;
+
+  // the old major sstable holds one large micro block
+  ObTableHandleV2 src_handle;
+  prepare_data(src_handle, micro_data, 1, SCHEMA_ROWKEY_CNT, log_ts_range, SNAPSHOT_VERSION);
+  ObSSTable *src_sstable = static_cast<ObSSTable *>(src_handle.get_table());
+  ASSERT_NE(nullptr, src_sstable);
+
+  // open its micro block the way ObPartitionMicroMergeIter does
+  ObDatumRange whole_range;
+  whole_range.set_whole_range();
+  const ObTableReadInfo *index_read_info = full_read_info_.get_index_read_info();
+  ASSERT_NE(nullptr, index_read_info);
+  ObIMacroBlockIterator *macro_iter = nullptr;
+  OK(src_sstable->scan_macro_block(whole_range, *index_read_info, allocator_, macro_iter, false, true, false));
+  ASSERT_NE(nullptr, macro_iter);
+  ObDataMacroBlockMeta macro_meta;
+  ObMacroBlockDesc macro_desc;
+  macro_desc.macro_meta_ = &macro_meta;
+  OK(macro_iter->get_next_macro_block(macro_desc));
+  ObIndexBlockMicroIterator micro_iter;
+  OK(micro_iter.init(macro_desc.range_, full_read_info_, macro_desc.macro_block_id_,
+      macro_iter->get_micro_index_infos(), macro_iter->get_micro_endkeys(),
+      static_cast<ObRowStoreType>(macro_desc.row_store_type_)));
+  const ObMicroBlock *micro_block = nullptr;
+  OK(micro_iter.next(micro_block));
+  ASSERT_NE(nullptr, micro_block);
+  const int64_t large_size = micro_block->header_.data_length_;
+
+  // the new major sstable starts with a few rewritten rows
+  ObSSTableMergeInfo merge_info;
+  reset_writer(SNAPSHOT_VERSION);
+  data_desc_.merge_info_ = &merge_info;
+  append_rows(small_data.c_str());
+  ObIMicroBlockWriter *micro_writer = macro_writer_.micro_writer_;
+  ASSERT_EQ(SMALL_ROW_CNT, micro_writer->get_row_count());
+  // the incoming micro block is larger than half of a micro block and does not
+  // fit behind the pending rows
+  data_desc_.micro_block_size_ = large_size + micro_writer->get_block_size() - 1;
+  ASSERT_GT(large_size, data_desc_.micro_block_size_ / 2);
+  ASSERT_LE(micro_writer->get_block_size(), data_desc_.micro_block_size_ / 2);
+
+  bool need_merge = true;
+  OK(macro_writer_.check_micro_block_need_merge(*micro_block, need_merge));
+  ASSERT_FALSE(need_merge);
+  const int64_t micro_cnt = macro_writer_.macro_blocks_[macro_writer_.current_index_].get_micro_block_count();
+  OK(macro_writer_.append_micro_block(*micro_block));
+  // pending rows flushed as their own micro block, the incoming one reused
+  ASSERT_EQ(0, micro_writer->get_row_count());
+  ASSERT_EQ(micro_cnt + 2, macro_writer_.macro_blocks_[macro_writer_.current_index_].get_micro_block_count());
+  ASSERT_EQ(1, merge_info.multiplexed_micro_count_in_new_macro_);
+
+  // a small micro block is still merged to keep it compacted
+  ObMicroBlock small_block = *micro_block;
+  small_block.header_.data_length_ = data_desc_.micro_block_size_ / 2;
+  OK(macro_writer_.check_micro_block_need_merge(small_block, need_merge));
+  ASSERT_TRUE(need_merge);
+  ASSERT_EQ(OB_ITER_END, micro_iter.next(micro_block));
+
+  data_desc_.merge_info_ = nullptr;
+  ObTableHandleV2 dst_handle;
+  prepare_data_end(dst_handle);
+  ObSSTable *dst_sstable = static_cast<ObSSTable *>(dst_handle.get_table());
+  ASSERT_NE(nullptr, dst_sstable);
+
+  // scan returns the rewritten rows followed by the reused ones, unchanged
+  ObSEArray<int64_t, 16> src_keys;
+  ObSEArray<int64_t, 16> dst_keys;
+  scan_keys(*src_sstable, src_keys);
+  scan_keys(*dst_sstable, dst_keys);
+  ASSERT_EQ(LARGE_ROW_CNT, src_keys.count());
+  ASSERT_EQ(SMALL_ROW_CNT + LARGE_ROW_CNT, dst_keys.count());
+  for (int64_t i = 0; i < SMALL_ROW_CNT; ++i) {
+    ASSERT_EQ(1 + i, dst_keys.at(i));
+  }
+  for (int64_t i = 0; i < LARGE_ROW_CNT; ++i) {
+    ASSERT_EQ(src_keys.at(i), dst_keys.at(SMALL_ROW_CNT + i));
+  }
+  macro_iter->~ObIMacroBlockIterator();
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_macro_block_writer_reuse.log*");
+  OB_LOGGER.set_file_name("test_macro_block_writer_reuse.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
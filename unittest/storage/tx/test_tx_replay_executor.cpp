@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "storage/tx/ob_tx_replay_executor.h"
+#include "storage/tx/ob_tx_log.h"
+#include "storage/ls/ob_ls.h"
+#include "storage/tablet/ob_tablet.h"
+#include "mtlenv/mock_tenant_module_env.h"
+#include "observer/ob_safe_destroy_thread.h"
+#include "storage/test_dml_common.h"
+#include "storage/slog_ckpt/ob_server_checkpoint_slog_handler.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace storage;
+using namespace transaction;
+
+namespace unittest
+{
+
+class TestTxReplayExecutor : public ::testing::Test
+{
+public:
+  TestTxReplayExecutor() : ls_(nullptr) {}
+  virtual ~TestTxReplayExecutor() {}
+  static void SetUpTestCase();
+  static void TearDownTestCase();
+  virtual void SetUp();
+  virtual void TearDown() { ls_handle_.reset(); }
+
+  static int create_tablet(const ObTabletID &tablet_id);
+  // the rows of one redo log, as replay_one_row_in_memtable_ looks them up
+  void replay_rows(ObTxReplayExecutor &executor, const ObTabletID *tablet_ids, const int64_t row_cnt);
+  // the end of replay_redo_in_memtable_ for a redo log whose mutator can not be read
+  void replay_broken_redo(ObTxReplayExecutor &executor);
+
+  static const uint64_t TEST_TENANT_ID = 1;
+  static const int64_t TEST_LS_ID = 1001;
+  static const int64_t LOG_TS = 100;
+  ObLSHandle ls_handle_;
+  ObLS *ls_;
+};
+
+void TestTxReplayExecutor::SetUpTestCase()
+{
+  int ret = OB_SUCCESS;
+  ret = MockTenantModuleEnv::get_instance().init();
+  ASSERT_EQ(OB_SUCCESS, ret);
+  SAFE_DESTROY_INSTANCE.init();
+  SAFE_DESTROY_INSTANCE.start();
+  ObServerCheckpointSlogHandler::get_instance().is_started_ = true;
+
+  ObLSHandle ls_handle;
+  ret = TestDmlCommon::create_ls(TEST_TENANT_ID, ObLSID(TEST_LS_ID), ls_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+}
+
+void TestTxReplayExecutor::TearDownTestCase()
+{
+  ASSERT_EQ(OB_SUCCESS, MTL(ObLSService*)->remove_ls(ObLSID(TEST_LS_ID), false));
+  SAFE_DESTROY_INSTANCE.stop();
+  SAFE_DESTROY_INSTANCE.wait();
+  SAFE_DESTROY_INSTANCE.destroy();
+  MockTenantModuleEnv::get_instance().destroy();
+}
+
+void TestTxReplayExecutor::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, MTL(ObLSService*)->get_ls(ObLSID(TEST_LS_ID), ls_handle_, ObLSGetMod::STORAGE_MOD));
+  ls_ = ls_handle_.get_ls();
+  ASSERT_NE(nullptr, ls_);
+}
+
+int TestTxReplayExecutor::create_tablet(const ObTabletID &tablet_id)
+{
+  int ret = OB_SUCCESS;
+  ObLSHandle ls_handle;
+  obrpc::ObBatchCreateTabletArg arg;
+  ObMulSourceDataNotifyArg trans_flags;
+  trans_flags.tx_id_ = 123;
+  trans_flags.log_ts_ = -1;
+  trans_flags.for_replay_ = false;
+  if (OB_FAIL(MTL(ObLSService*)->get_ls(ObLSID(TEST_LS_ID), ls_handle, ObLSGetMod::STORAGE_MOD))) {
+    LOG_WARN("failed to get ls", K(ret));
+  } else if (OB_FAIL(TestDmlCommon::build_pure_data_tablet_arg(
+      TEST_TENANT_ID, ObLSID(TEST_LS_ID), tablet_id, arg))) {
+    LOG_WARN("failed to build pure data tablet arg", K(ret), K(tablet_id));
+  } else if (OB_FAIL(ls_handle.get_ls()->get_tablet_svr()->on_prepare_create_tablets(arg, trans_flags))) {
+    LOG_WARN("failed to prepare create tablets", K(ret), K(arg));
+  } else if (FALSE_IT(trans_flags.log_ts_ = LOG_TS - 10)) {
+  } else if (OB_FAIL(ls_handle.get_ls()->get_tablet_svr()->on_redo_create_tablets(arg, trans_flags))) {
+    LOG_WARN("failed to redo create tablets", K(ret), K(arg));
+  } else if (FALSE_IT(++trans_flags.log_ts_)) {
+  } else if (OB_FAIL(ls_handle.get_ls()->get_tablet_svr()->on_commit_create_tablets(arg, trans_flags))) {
+    LOG_WARN("failed to commit create tablets", K(ret), K(arg));
+  }
+  return ret;
+}
+
+void TestTxReplayExecutor::replay_rows(
+    ObTxReplayExecutor &executor,
+    const ObTabletID *tablet_ids,
+    const int64_t row_cnt)
+{
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ObTablet *tablet = nullptr;
+    ASSERT_EQ(OB_SUCCESS, executor.get_tablet_(tablet_ids[i], tablet));
+    ASSERT_NE(nullptr, tablet);
+    ASSERT_EQ(tablet_ids[i], tablet->get_tablet_meta().tablet_id_);
+    ASSERT_EQ(tablet_ids[i], executor.cached_tablet_id_);
+    ASSERT_EQ(tablet, executor.cached_tablet_handle_.get_obj());
+  }
+}
+
+void TestTxReplayExecutor::replay_broken_redo(ObTxReplayExecutor &executor)
+{
+  ObTxRedoLogTempRef temp_ref;
+  ObTxRedoLog redo(temp_ref);
+  char mutator_buf[16];
+  memset(mutator_buf, 0xff, sizeof(mutator_buf));
+  redo.replay_mutator_buf_ = mutator_buf;
+  redo.mutator_size_ = sizeof(mutator_buf);
+  // no row is replayed, whatever the mutator header decodes to
+  executor.replay_redo_in_memtable_(redo);
+}
+
+TEST_F(TestTxReplayExecutor, one_redo_log_two_tablets)
+{
+  const ObTabletID tablet_a(200001);
+  const ObTabletID tablet_b(200002);
+  ASSERT_EQ(OB_SUCCESS, create_tablet(tablet_a));
+  ASSERT_EQ(OB_SUCCESS, create_tablet(tablet_b));
+
+  palf::LSN lsn(0);
+  ObTxReplayExecutor executor(ls_, nullptr, lsn, LOG_TS);
+  // rows are clustered by tablet but may switch back and forth, every row
+  // must see its own tablet
+  const ObTabletID rows[] = {tablet_a, tablet_a, tablet_b, tablet_b, tablet_a, tablet_b};
+  replay_rows(executor, rows, sizeof(rows) / sizeof(rows[0]));
+
+  // the handle never outlives the redo log, also when it fails and is retried
+  replay_broken_redo(executor);
+  ASSERT_FALSE(executor.cached_tablet_id_.is_valid());
+  ASSERT_FALSE(executor.cached_tablet_handle_.is_valid());
+
+  ObSArray<ObTabletID> tablet_ids;
+  ASSERT_EQ(OB_SUCCESS, tablet_ids.push_back(tablet_a));
+  ASSERT_EQ(OB_SUCCESS, tablet_ids.push_back(tablet_b));
+  ASSERT_EQ(OB_SUCCESS, ls_->get_tablet_svr()->remove_tablets(tablet_ids));
+}
+
+TEST_F(TestTxReplayExecutor, tablet_removed_between_logs)
+{
+  const ObTabletID tablet_a(200003);
+  const ObTabletID tablet_b(200004);
+  ASSERT_EQ(OB_SUCCESS, create_tablet(tablet_a));
+  ASSERT_EQ(OB_SUCCESS, create_tablet(tablet_b));
+
+  palf::LSN lsn(0);
+  ObTxReplayExecutor executor(ls_, nullptr, lsn, LOG_TS);
+  // first redo log ends on tablet b
+  const ObTabletID first_log[] = {tablet_a, tablet_b};
+  replay_rows(executor, first_log, sizeof(first_log) / sizeof(first_log[0]));
+  replay_broken_redo(executor);
+  ASSERT_FALSE(executor.cached_tablet_handle_.is_valid());
+
+  // tablet b is removed before the next redo log
+  ObSArray<ObTabletID> tablet_ids;
+  ASSERT_EQ(OB_SUCCESS, tablet_ids.push_back(tablet_b));
+  ASSERT_EQ(OB_SUCCESS, ls_->get_tablet_svr()->remove_tablets(tablet_ids));
+
+  // the next redo log looks tablet b up again instead of using the old handle
+  ObTablet *tablet = nullptr;
+  const int ret = executor.get_tablet_(tablet_b, tablet);
+  ASSERT_TRUE(OB_TABLET_NOT_EXIST == ret || OB_EAGAIN == ret) << ret;
+  ASSERT_EQ(nullptr, tablet);
+  ASSERT_FALSE(executor.cached_tablet_id_.is_valid());
+  ASSERT_FALSE(executor.cached_tablet_handle_.is_valid());
+
+  // and still finds the tablets that are left
+  const ObTabletID second_log[] = {tablet_a, tablet_a};
+  replay_rows(executor, second_log, sizeof(second_log) / sizeof(second_log[0]));
+  executor.reset_cached_tablet_();
+
+  tablet_ids.reset();
+  ASSERT_EQ(OB_SUCCESS, tablet_ids.push_back(tablet_a));
+  ASSERT_EQ(OB_SUCCESS, ls_->get_tablet_svr()->remove_tablets(tablet_ids));
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_tx_replay_executor.log*");
+  OB_LOGGER.set_file_name("test_tx_replay_executor.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}